@@ -0,0 +1,67 @@
+#ifndef AISDI_LINEAR_BENCH_BUILDINFO_H
+#define AISDI_LINEAR_BENCH_BUILDINFO_H
+
+// Where the measured binary comes from, recorded with the results so that results of different
+// versions can be told apart. bench/CMakeLists.txt defines these at configure time, so the
+// revision is the one of the last cmake run (with -dirty for uncommitted changes).
+#ifndef AISDI_BENCH_REVISION
+#define AISDI_BENCH_REVISION "unknown"
+#endif
+
+#ifndef AISDI_BENCH_BUILD_TYPE
+#define AISDI_BENCH_BUILD_TYPE ""
+#endif
+
+#ifndef AISDI_BENCH_FLAGS
+#define AISDI_BENCH_FLAGS ""
+#endif
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+struct BuildInfo
+{
+    static const char * revision()
+    {
+        return AISDI_BENCH_REVISION;
+    }
+
+    static const char * buildType()
+    {
+        return AISDI_BENCH_BUILD_TYPE;
+    }
+
+    static const char * flags()
+    {
+        return AISDI_BENCH_FLAGS;
+    }
+
+    static const char * compiler()
+    {
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#else
+        return "unknown";
+#endif
+    }
+
+    static bool isOptimized()
+    {
+#ifdef __OPTIMIZE__
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_BUILDINFO_H
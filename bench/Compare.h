@@ -0,0 +1,461 @@
+#ifndef AISDI_LINEAR_BENCH_COMPARE_H
+#define AISDI_LINEAR_BENCH_COMPARE_H
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Harness.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// What a comparison needs of one result, read back from a JSON or CSV report.
+struct Record
+{
+    std::string operation;
+    std::string container;
+    std::string type;
+    std::size_t size;
+    double median; // ns per step
+    std::vector<double> samples;
+
+    bool isSameCase(const Record& other) const
+    {
+        return operation == other.operation && container == other.container && type == other.type
+            && size == other.size;
+    }
+};
+
+inline Record toRecord(const Result& result)
+{
+    return Record { result.operation, result.container, result.type, result.size, result.summary.median,
+                    result.samples };
+}
+
+// Reads the JSON Report writes (any JSON is parsed, only the fields of Record are kept).
+class JsonRecordReader
+{
+public:
+    explicit JsonRecordReader(const std::string& text) : text(text), position(0)
+    {
+
+    }
+
+    std::vector<Record> read()
+    {
+        std::vector<Record> records;
+        expect('{');
+        if(!tryConsume('}'))
+        {
+            do
+            {
+                const std::string key = readString();
+                expect(':');
+                if(key == "results")
+                    readResults(records);
+                else
+                    skipValue();
+            }
+            while(tryConsume(','));
+            expect('}');
+        }
+        return records;
+    }
+
+private:
+    const std::string& text;
+    std::size_t position;
+
+    [[noreturn]] void fail(const std::string& what) const
+    {
+        throw std::runtime_error("Malformed JSON at offset " + std::to_string(position) + ": " + what);
+    }
+
+    char peek()
+    {
+        while(position < text.size() && std::isspace(static_cast<unsigned char>(text[position])))
+            ++position;
+        return position < text.size() ? text[position] : '\0';
+    }
+
+    bool tryConsume(char c)
+    {
+        if(peek() != c)
+            return false;
+        ++position;
+        return true;
+    }
+
+    void expect(char c)
+    {
+        if(!tryConsume(c))
+            fail(std::string("expected '") + c + "'");
+    }
+
+    std::string readString()
+    {
+        expect('"');
+        std::string value;
+        while(position < text.size() && text[position] != '"')
+        {
+            char c = text[position++];
+            if(c == '\\' && position < text.size())
+            {
+                c = text[position++];
+                if(c == 'u') // only the control characters Report escapes this way
+                {
+                    if(position + 4 > text.size())
+                        fail("truncated escape");
+                    c = static_cast<char>(std::stoi(text.substr(position, 4), nullptr, 16));
+                    position += 4;
+                }
+                else if(c == 'n')
+                    c = '\n';
+                else if(c == 't')
+                    c = '\t';
+            }
+            value += c;
+        }
+        expect('"');
+        return value;
+    }
+
+    double readNumber()
+    {
+        peek();
+        const char * begin = text.c_str() + position;
+        char * end = nullptr;
+        const double value = std::strtod(begin, &end);
+        if(end == begin)
+            fail("expected a number");
+        position += end - begin;
+        return value;
+    }
+
+    void skipValue()
+    {
+        const char c = peek();
+        if(c == '"')
+            readString();
+        else if(c == '{' || c == '[')
+        {
+            const char closing = c == '{' ? '}' : ']';
+            ++position;
+            if(tryConsume(closing))
+                return;
+            do
+            {
+                if(c == '{')
+                {
+                    readString();
+                    expect(':');
+                }
+                skipValue();
+            }
+            while(tryConsume(','));
+            expect(closing);
+        }
+        else if(text.compare(position, 4, "true") == 0 || text.compare(position, 4, "null") == 0)
+            position += 4;
+        else if(text.compare(position, 5, "false") == 0)
+            position += 5;
+        else
+            readNumber();
+    }
+
+    void readResults(std::vector<Record>& records)
+    {
+        expect('[');
+        if(tryConsume(']'))
+            return;
+        do
+            records.push_back(readRecord());
+        while(tryConsume(','));
+        expect(']');
+    }
+
+    Record readRecord()
+    {
+        Record record = Record();
+        expect('{');
+        if(tryConsume('}'))
+            return record;
+        do
+        {
+            const std::string key = readString();
+            expect(':');
+            if(key == "operation")
+                record.operation = readString();
+            else if(key == "container")
+                record.container = readString();
+            else if(key == "type")
+                record.type = readString();
+            else if(key == "size")
+                record.size = static_cast<std::size_t>(readNumber());
+            else if(key == "medianNs")
+                record.median = readNumber();
+            else if(key == "samplesNs")
+            {
+                expect('[');
+                if(!tryConsume(']'))
+                {
+                    do
+                        record.samples.push_back(readNumber());
+                    while(tryConsume(','));
+                    expect(']');
+                }
+            }
+            else
+                skipValue();
+        }
+        while(tryConsume(','));
+        expect('}');
+        return record;
+    }
+};
+
+// Splits a CSV line, quoted fields as RFC 4180 has them (without line breaks inside).
+inline std::vector<std::string> splitCsvLine(const std::string& line)
+{
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+    for(std::size_t i = 0; i < line.size(); ++i)
+    {
+        const char c = line[i];
+        if(quoted && c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+        {
+            fields.back() += '"';
+            ++i;
+        }
+        else if(c == '"')
+            quoted = !quoted;
+        else if(c == ',' && !quoted)
+            fields.push_back("");
+        else if(c != '\r')
+            fields.back() += c;
+    }
+    return fields;
+}
+
+// Reads the CSV Report writes: the columns are found by the names in the header line, repeated
+// header lines (of concatenated files) are skipped.
+inline std::vector<Record> readCsvRecords(const std::string& text)
+{
+    std::istringstream lines(text);
+    std::string line;
+    if(!std::getline(lines, line))
+        return std::vector<Record>();
+    const std::vector<std::string> header = splitCsvLine(line);
+    const char * const names[] = { "operation", "container", "type", "size", "medianNs", "samplesNs" };
+    std::size_t columns[6];
+    for(std::size_t i = 0; i < 6; ++i)
+    {
+        columns[i] = std::find(header.begin(), header.end(), names[i]) - header.begin();
+        if(columns[i] == header.size())
+            throw std::runtime_error(std::string("No ") + names[i] + " column in the CSV header");
+    }
+
+    std::vector<Record> records;
+    while(std::getline(lines, line))
+    {
+        const std::vector<std::string> fields = splitCsvLine(line);
+        if(line.empty() || fields == header)
+            continue;
+        if(fields.size() < header.size())
+            throw std::runtime_error("Too few CSV fields in: " + line);
+        Record record = Record();
+        record.operation = fields[columns[0]];
+        record.container = fields[columns[1]];
+        record.type = fields[columns[2]];
+        record.size = static_cast<std::size_t>(std::stoull(fields[columns[3]]));
+        record.median = std::stod(fields[columns[4]]);
+        std::istringstream samples(fields[columns[5]]);
+        std::string sample;
+        while(std::getline(samples, sample, ';'))
+            record.samples.push_back(std::stod(sample));
+        records.push_back(record);
+    }
+    return records;
+}
+
+// JSON or CSV, told apart by the first character.
+inline std::vector<Record> readRecords(const std::string& path)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::runtime_error("Cannot read " + path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    const std::string text = contents.str();
+    const std::size_t first = text.find_first_not_of(" \t\r\n");
+    if(first != std::string::npos && text[first] == '{')
+        return JsonRecordReader(text).read();
+    return readCsvRecords(text);
+}
+
+// Number of ways to pick left of ranks[first..] that add up to at least wanted with sum so far.
+inline std::size_t countRankSumsAtLeast(const std::vector<double>& ranks, std::size_t first, std::size_t left,
+                                        double sum, double wanted)
+{
+    if(left == 0)
+        return sum >= wanted - 1e-9 ? 1 : 0;
+    std::size_t count = 0;
+    for(std::size_t i = first; i + left <= ranks.size(); ++i)
+        count += countRankSumsAtLeast(ranks, i + 1, left - 1, sum + ranks[i], wanted);
+    return count;
+}
+
+// One-sided Mann-Whitney U test: the probability of the current samples being ranked this high
+// (or higher) above the baseline ones if both came from the same distribution. Rank based, so
+// a single preempted sample does not decide it. Exact (all the ways to split the ranks) for up
+// to 10 samples each, beyond that the normal approximation with the tie and continuity
+// corrections. 1 when it cannot tell anything, e.g. from single samples.
+inline double probabilityOfNotGreater(const std::vector<double>& baseline, const std::vector<double>& current)
+{
+    if(baseline.empty() || current.empty())
+        return 1;
+
+    std::vector<double> all(baseline);
+    all.insert(all.end(), current.begin(), current.end());
+    std::vector<std::size_t> order(all.size());
+    for(std::size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&all](std::size_t a, std::size_t b) { return all[a] < all[b]; });
+    std::vector<double> ranks(all.size()); // ties get the mean of their ranks
+    double ties = 0;
+    for(std::size_t i = 0; i < order.size(); )
+    {
+        std::size_t j = i;
+        while(j < order.size() && all[order[j]] == all[order[i]])
+            ++j;
+        for(std::size_t k = i; k < j; ++k)
+            ranks[order[k]] = (i + j + 1) / 2.0;
+        const double t = static_cast<double>(j - i);
+        ties += t * t * t - t;
+        i = j;
+    }
+    double rankSum = 0;
+    for(std::size_t i = baseline.size(); i < all.size(); ++i)
+        rankSum += ranks[i];
+
+    if(baseline.size() <= 10 && current.size() <= 10)
+    {
+        double splits = 1;
+        for(std::size_t i = 0; i < current.size(); ++i)
+            splits = splits * (all.size() - i) / (i + 1);
+        return countRankSumsAtLeast(ranks, 0, current.size(), 0, rankSum) / splits;
+    }
+
+    const double n1 = static_cast<double>(baseline.size());
+    const double n2 = static_cast<double>(current.size());
+    const double n = n1 + n2;
+    const double u = rankSum - n2 * (n2 + 1) / 2; // pairs with current above baseline, ties as halves
+    const double variance = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)));
+    if(variance <= 0)
+        return 1;
+    const double z = (u - n1 * n2 / 2 - 0.5) / std::sqrt(variance);
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+enum class Verdict
+{
+    unchanged,
+    regression,
+    improvement
+};
+
+struct Comparison
+{
+    Record baseline;
+    Record current;
+    double change; // of the median, in percent of the baseline one
+    double pValue; // of the change in its direction happening by chance
+    Verdict verdict;
+};
+
+// A case regressed when its median grew by more than threshold percent and the samples say
+// it is not chance (pValue below alpha); improvements likewise. Cases found in one of the
+// files only are not compared.
+inline std::vector<Comparison> compareRecords(const std::vector<Record>& baseline, const std::vector<Record>& current,
+                                              double threshold, double alpha)
+{
+    std::vector<Comparison> comparisons;
+    for(const Record& now : current)
+    {
+        for(const Record& before : baseline)
+        {
+            if(!now.isSameCase(before))
+                continue;
+            Comparison comparison { before, now, 0, 1, Verdict::unchanged };
+            if(before.median > 0)
+                comparison.change = 100 * (now.median - before.median) / before.median;
+            if(comparison.change >= 0)
+                comparison.pValue = probabilityOfNotGreater(before.samples, now.samples);
+            else
+                comparison.pValue = probabilityOfNotGreater(now.samples, before.samples);
+            if(comparison.pValue < alpha && comparison.change > threshold)
+                comparison.verdict = Verdict::regression;
+            else if(comparison.pValue < alpha && comparison.change < -threshold)
+                comparison.verdict = Verdict::improvement;
+            comparisons.push_back(comparison);
+            break;
+        }
+    }
+    return comparisons;
+}
+
+// Prints every comparison and returns the number of regressions.
+inline std::size_t printComparisons(std::ostream& out, const std::vector<Comparison>& comparisons,
+                                    std::size_t unmatched, double threshold, double alpha)
+{
+    if(comparisons.empty())
+        out << "# no case found in both files\n";
+    out << std::left << std::setw(16) << "operation" << std::setw(13) << "container" << std::setw(8) << "type"
+        << std::right << std::setw(10) << "size" << std::setw(14) << "baseline ns" << std::setw(14) << "current ns"
+        << std::setw(10) << "change %" << std::setw(10) << "p" << "  verdict\n";
+    std::size_t regressions = 0;
+    for(const Comparison& comparison : comparisons)
+    {
+        const Record& current = comparison.current;
+        out << std::left << std::setw(16) << current.operation << std::setw(13) << current.container
+            << std::setw(8) << current.type << std::right << std::setw(10) << current.size << std::fixed
+            << std::setprecision(2) << std::setw(14) << comparison.baseline.median << std::setw(14) << current.median
+            << std::setprecision(1) << std::setw(10) << comparison.change
+            << std::setprecision(4) << std::setw(10) << comparison.pValue << "  ";
+        if(comparison.verdict == Verdict::regression)
+        {
+            out << "REGRESSION";
+            ++regressions;
+        }
+        else if(comparison.verdict == Verdict::improvement)
+            out << "improvement";
+        else
+            out << "-";
+        out << "\n";
+    }
+    out << "# " << comparisons.size() << " cases compared";
+    if(unmatched > 0)
+        out << ", " << unmatched << " found in one file only";
+    out << "; " << regressions << " regressions beyond " << std::setprecision(1) << threshold
+        << " % (p < " << std::setprecision(3) << alpha << ")" << std::endl;
+    return regressions;
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_COMPARE_H
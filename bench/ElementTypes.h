@@ -0,0 +1,293 @@
+#ifndef AISDI_LINEAR_BENCH_ELEMENTTYPES_H
+#define AISDI_LINEAR_BENCH_ELEMENTTYPES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Plain data of Bytes bytes, a record copied by memcpy.
+template <std::size_t Bytes>
+struct Pod
+{
+    std::uint64_t words[Bytes / sizeof(std::uint64_t)];
+};
+
+using Pod64 = Pod<64>;
+using Pod1K = Pod<1024>;
+
+// A string too long for the small string buffer: every copy allocates, a move does not.
+struct HeapString
+{
+    std::string text;
+};
+
+// Constructions and assignments of OperationCountingObject.
+struct ElementOperations
+{
+    std::uint64_t copies; // copy constructions
+    std::uint64_t moves; // move constructions
+    std::uint64_t copyAssignments;
+    std::uint64_t moveAssignments;
+
+    ElementOperations operator-(const ElementOperations& other) const
+    {
+        return ElementOperations { copies - other.copies, moves - other.moves,
+                                   copyAssignments - other.copyAssignments, moveAssignments - other.moveAssignments };
+    }
+};
+
+// As the one of tests/VectorTests.cpp, with the copies and the moves of constructions and of
+// assignments counted apart; the counts are never reset, the harness takes differences.
+class OperationCountingObject
+{
+public:
+    OperationCountingObject(int value_ = 0)
+        : value(value_)
+    {
+
+    }
+
+    OperationCountingObject(const OperationCountingObject& other)
+        : value(other.value)
+    {
+        ++counts().copies;
+    }
+
+    OperationCountingObject(OperationCountingObject&& other) noexcept
+        : value(other.value)
+    {
+        ++counts().moves;
+    }
+
+    OperationCountingObject& operator=(const OperationCountingObject& other)
+    {
+        ++counts().copyAssignments;
+        value = other.value;
+        return *this;
+    }
+
+    OperationCountingObject& operator=(OperationCountingObject&& other) noexcept
+    {
+        ++counts().moveAssignments;
+        value = other.value;
+        return *this;
+    }
+
+    operator int() const
+    {
+        return value;
+    }
+
+    static ElementOperations& counts()
+    {
+        static ElementOperations all { 0, 0, 0, 0 };
+        return all;
+    }
+
+private:
+    int value;
+};
+
+// Name shown and filtered by (--type), the i-th value stored by the operations, a cheap digest
+// the traversals read from an element without copying it (so that move-only elements can be
+// traversed and counted ones are not), and the heap bytes every element owns.
+template <typename Type>
+struct Element;
+
+template <>
+struct Element<std::int32_t>
+{
+    static const char * name()
+    {
+        return "int32";
+    }
+
+    static std::int32_t make(std::size_t i)
+    {
+        return static_cast<std::int32_t>(i);
+    }
+
+    static std::uint64_t digest(std::int32_t item)
+    {
+        return static_cast<std::uint64_t>(item);
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return 0;
+    }
+};
+
+template <>
+struct Element<std::uint64_t>
+{
+    static const char * name()
+    {
+        return "uint64";
+    }
+
+    static std::uint64_t make(std::size_t i)
+    {
+        return i;
+    }
+
+    static std::uint64_t digest(std::uint64_t item)
+    {
+        return item;
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return 0;
+    }
+};
+
+template <>
+struct Element<std::string>
+{
+    static const char * name()
+    {
+        return "string";
+    }
+
+    static std::string make(std::size_t)
+    {
+        return "ELEMENCIK"; // as in src/main.cpp, fits in the small string buffer
+    }
+
+    static std::uint64_t digest(const std::string& item)
+    {
+        return item.empty() ? 0 : static_cast<unsigned char>(item[0]);
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return 0;
+    }
+};
+
+template <>
+struct Element<HeapString>
+{
+    static const std::size_t length = 48;
+
+    static const char * name()
+    {
+        return "heapString";
+    }
+
+    static HeapString make(std::size_t i)
+    {
+        return HeapString { std::string(length, static_cast<char>('a' + i % 26)) };
+    }
+
+    static std::uint64_t digest(const HeapString& item)
+    {
+        return item.text.empty() ? 0 : static_cast<unsigned char>(item.text[0]);
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return length + 1;
+    }
+};
+
+template <std::size_t Bytes>
+struct PodElement
+{
+    static Pod<Bytes> make(std::size_t i)
+    {
+        Pod<Bytes> item = Pod<Bytes>();
+        item.words[0] = i;
+        return item;
+    }
+
+    static std::uint64_t digest(const Pod<Bytes>& item)
+    {
+        return item.words[0];
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return 0;
+    }
+};
+
+template <>
+struct Element<Pod64> : PodElement<64>
+{
+    static const char * name()
+    {
+        return "pod64";
+    }
+};
+
+template <>
+struct Element<Pod1K> : PodElement<1024>
+{
+    static const char * name()
+    {
+        return "pod1k";
+    }
+};
+
+template <>
+struct Element<std::unique_ptr<std::uint64_t>>
+{
+    static const char * name()
+    {
+        return "moveOnly";
+    }
+
+    static std::unique_ptr<std::uint64_t> make(std::size_t i)
+    {
+        return std::unique_ptr<std::uint64_t>(new std::uint64_t(i));
+    }
+
+    static std::uint64_t digest(const std::unique_ptr<std::uint64_t>& item)
+    {
+        return item ? *item : 0;
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return sizeof(std::uint64_t);
+    }
+};
+
+template <>
+struct Element<OperationCountingObject>
+{
+    static const char * name()
+    {
+        return "counted";
+    }
+
+    static OperationCountingObject make(std::size_t i)
+    {
+        return OperationCountingObject(static_cast<int>(i));
+    }
+
+    static std::uint64_t digest(const OperationCountingObject& item)
+    {
+        return static_cast<std::uint64_t>(static_cast<int>(item));
+    }
+
+    static std::size_t ownedBytes()
+    {
+        return 0;
+    }
+};
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_ELEMENTTYPES_H
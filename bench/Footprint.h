@@ -0,0 +1,311 @@
+#ifndef AISDI_LINEAR_BENCH_FOOTPRINT_H
+#define AISDI_LINEAR_BENCH_FOOTPRINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include "Vector.h"
+#include "LinkedList.h"
+
+#include "ElementTypes.h"
+#include "HeapCounter.h"
+#include "Operations.h"
+#include "StdAdapters.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Resident set of the process (/proc/self/statm), 0 where unknown.
+inline std::size_t residentBytes()
+{
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0;
+    std::size_t residentPages = 0;
+    if(!(statm >> pages >> residentPages))
+        return 0;
+    return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+// The largest resident set of the process so far (getrusage), 0 where unknown.
+inline std::size_t peakResidentBytes()
+{
+#ifdef __linux__
+    rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // in KiB on Linux
+#else
+    return 0;
+#endif
+}
+
+// What a container tells about its own memory: the bytes it requested once its allocation
+// stats are enabled, and its capacity in elements.
+template <typename Container>
+struct FootprintProbe
+{
+    static const bool hasStats = false;
+    static const bool hasCapacity = false;
+
+    static void enable(Container&)
+    {
+
+    }
+
+    static std::size_t requested(const Container&)
+    {
+        return 0;
+    }
+
+    static std::size_t capacity(const Container&)
+    {
+        return 0;
+    }
+};
+
+template <typename Type>
+struct FootprintProbe<Vector<Type>>
+{
+    static const bool hasStats = true;
+    static const bool hasCapacity = true;
+
+    static void enable(Vector<Type>& container)
+    {
+        container.enableAllocationStats();
+    }
+
+    static std::size_t requested(const Vector<Type>& container)
+    {
+        return container.stats().liveBytes;
+    }
+
+    static std::size_t capacity(const Vector<Type>& container)
+    {
+        return container.getCapacity();
+    }
+};
+
+template <typename Type>
+struct FootprintProbe<LinkedList<Type>>
+{
+    static const bool hasStats = true;
+    static const bool hasCapacity = false;
+
+    static void enable(LinkedList<Type>& container)
+    {
+        container.enableAllocationStats();
+    }
+
+    static std::size_t requested(const LinkedList<Type>& container)
+    {
+        return container.stats().liveBytes;
+    }
+
+    static std::size_t capacity(const LinkedList<Type>&)
+    {
+        return 0;
+    }
+};
+
+template <typename Type>
+struct FootprintProbe<StdAdapter<std::vector<Type>>>
+{
+    static const bool hasStats = false;
+    static const bool hasCapacity = true;
+
+    static void enable(StdAdapter<std::vector<Type>>&)
+    {
+
+    }
+
+    static std::size_t requested(const StdAdapter<std::vector<Type>>&)
+    {
+        return 0;
+    }
+
+    static std::size_t capacity(const StdAdapter<std::vector<Type>>& container)
+    {
+        return container.getItems().capacity();
+    }
+};
+
+// Memory of a container holding size elements appended one by one. The heap bytes are the
+// usable sizes of its blocks plus the allocator header of each, the total adds the container
+// object itself; both are compared to the payload, size times the size of an element with
+// the heap bytes it owns (e.g. the buffer of a long string, also among the blocks).
+struct Footprint
+{
+    std::string container;
+    std::string type;
+    std::size_t size;
+    std::size_t payloadBytes;
+    std::size_t objectBytes; // sizeof the container
+    std::size_t blocks; // live heap blocks
+    std::size_t requestedBytes; // by the container itself, if hasStats
+    std::size_t heapBytes;
+    std::size_t peakHeapBytes; // usable bytes at the worst moment of the build, e.g. during growth
+    std::size_t residentBytes; // growth of the resident set, in whole pages
+    std::size_t capacity; // in elements, if hasCapacity
+    bool hasStats;
+    bool hasCapacity;
+
+    std::size_t getTotalBytes() const
+    {
+        return heapBytes + objectBytes;
+    }
+
+    double perElement(std::size_t bytes) const
+    {
+        return size > 0 ? static_cast<double>(bytes) / size : bytes;
+    }
+
+    // percent of the total above the payload
+    double overhead() const
+    {
+        return payloadBytes > 0 ? 100.0 * (static_cast<double>(getTotalBytes()) - payloadBytes) / payloadBytes : 0;
+    }
+
+    // percent of the capacity unused
+    double slack() const
+    {
+        return capacity > 0 ? 100.0 * (capacity - size) / capacity : 0;
+    }
+};
+
+template <typename Container>
+Footprint measureFootprint(std::size_t size)
+{
+    using Type = typename Container::value_type;
+    using Probe = FootprintProbe<Container>;
+
+    Footprint footprint = Footprint();
+    footprint.size = size;
+    footprint.payloadBytes = size * (sizeof(Type) + Element<Type>::ownedBytes());
+    footprint.objectBytes = sizeof(Container);
+    footprint.hasStats = Probe::hasStats;
+    footprint.hasCapacity = Probe::hasCapacity;
+
+    releaseFreeHeap();
+    resetHeapPeak();
+    const std::size_t residentBefore = residentBytes();
+    const HeapCounts before = heapCounts();
+    {
+        Container container;
+        const HeapCounts beforeStats = heapCounts();
+        Probe::enable(container);
+        const HeapCounts afterStats = heapCounts(); // the stats record is not the container's own
+        fill(container, size);
+        const HeapCounts after = heapCounts();
+        const std::size_t residentAfter = residentBytes();
+
+        const std::size_t statsBlocks = afterStats.allocations - beforeStats.allocations;
+        const std::size_t statsBytes = afterStats.liveBytes - beforeStats.liveBytes;
+        footprint.blocks = (after.allocations - before.allocations) - (after.frees - before.frees) - statsBlocks;
+        footprint.heapBytes = after.liveBytes - before.liveBytes - statsBytes + footprint.blocks * heapHeaderBytes();
+        footprint.peakHeapBytes = after.peakLiveBytes - before.liveBytes - statsBytes;
+        footprint.residentBytes = residentAfter > residentBefore ? residentAfter - residentBefore : 0;
+        footprint.requestedBytes = Probe::requested(container);
+        footprint.capacity = Probe::capacity(container);
+    }
+    return footprint;
+}
+
+struct FootprintCase
+{
+    std::string container;
+    std::string type;
+    std::function<Footprint(std::size_t)> footprint;
+
+    Footprint measure(std::size_t size) const
+    {
+        Footprint measured = footprint(size);
+        measured.container = container;
+        measured.type = type;
+        return measured;
+    }
+};
+
+class FootprintRegistry
+{
+public:
+    template <typename Container>
+    void add(const std::string& containerName)
+    {
+        using Type = typename Container::value_type;
+        cases.push_back(FootprintCase { containerName, Element<Type>::name(), &measureFootprint<Container> });
+    }
+
+    const std::vector<FootprintCase>& getCases() const
+    {
+        return cases;
+    }
+
+private:
+    std::vector<FootprintCase> cases;
+};
+
+// Vector growing like Vector::newCapacity() (8 elements first, then factor times as many) up
+// to size elements: what another factor would trade between spare capacity and reallocations.
+struct GrowthModel
+{
+    double factor;
+    std::size_t capacity; // when holding size elements
+    double slack; // percent of it unused
+    double meanSlack; // the same averaged over holding 1..size elements
+    std::size_t reallocations;
+    double copiesPerElement; // elements moved to the new blocks per element appended
+};
+
+inline std::size_t grownCapacity(std::size_t capacity, double factor)
+{
+    if(capacity == 0)
+        return 8;
+    const std::size_t grown = static_cast<std::size_t>(capacity * factor);
+    return grown > capacity ? grown : capacity + 1;
+}
+
+inline GrowthModel modelGrowth(std::size_t size, double factor)
+{
+    GrowthModel model = { factor, grownCapacity(0, factor), 0, 0, 0, 0 };
+    double slackSum = 0;
+    std::size_t copies = 0;
+    for(std::size_t count = 1; count <= size; ++count)
+    {
+        if(count > model.capacity)
+        {
+            copies += model.capacity;
+            model.capacity = grownCapacity(model.capacity, factor);
+            ++model.reallocations;
+        }
+        slackSum += 100.0 * (model.capacity - count) / model.capacity;
+    }
+    if(size > 0)
+    {
+        model.slack = 100.0 * (model.capacity - size) / model.capacity;
+        model.meanSlack = slackSum / size;
+        model.copiesPerElement = static_cast<double>(copies) / size;
+    }
+    return model;
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_FOOTPRINT_H
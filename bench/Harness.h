@@ -0,0 +1,418 @@
+#ifndef AISDI_LINEAR_BENCH_HARNESS_H
+#define AISDI_LINEAR_BENCH_HARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ElementTypes.h"
+#include "HeapCounter.h"
+#include "Histogram.h"
+#include "PerfCounters.h"
+#include "TickClock.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Monotonic: a wall clock (system_clock) may be stepped by NTP in the middle of a sample.
+using Clock = std::chrono::steady_clock;
+static_assert(Clock::is_steady, "The benchmark clock has to be monotonic");
+
+// Keeps the compiler from discarding the computation of value.
+template <typename T>
+inline void keep(const T& value)
+{
+    __asm__ __volatile__("" : : "r"(&value) : "memory");
+}
+
+// Storage for an object constructed and destroyed at chosen moments, e.g. outside of the timed
+// region, without assigning to it (the iterators of the containers are copy constructible only).
+template <typename T>
+class Deferred
+{
+public:
+    Deferred() : constructed(false)
+    {
+
+    }
+
+    Deferred(const Deferred&) = delete;
+    Deferred& operator=(const Deferred&) = delete;
+
+    ~Deferred()
+    {
+        destroy();
+    }
+
+    template <typename... Args>
+    T& construct(Args&&... args)
+    {
+        destroy();
+        T * object = new (&storage) T(std::forward<Args>(args)...);
+        constructed = true;
+        return *object;
+    }
+
+    void destroy()
+    {
+        if(constructed)
+        {
+            constructed = false;
+            get().~T();
+        }
+    }
+
+    T& get()
+    {
+        return *reinterpret_cast<T*>(&storage);
+    }
+
+    T& operator*()
+    {
+        return get();
+    }
+
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    bool constructed;
+};
+
+struct Options
+{
+    Options() : minSize(1000), maxSize(100000), sizeFactor(10), repetitions(7), warmup(1), list(false),
+        latency(false), batch(1), dumpHistograms(false), counters(false), allocations(false),
+        elementOperations(false), footprint(false), format("text"), threshold(10), alpha(0.05)
+    {
+
+    }
+
+    std::size_t minSize;
+    std::size_t maxSize;
+    std::size_t sizeFactor; // of the geometric sweep
+    std::vector<std::size_t> sizes; // replaces the sweep when given
+    std::size_t repetitions; // measured samples per case and size
+    std::size_t warmup; // discarded samples before them
+    std::vector<std::string> operations; // empty: all of them
+    std::vector<std::string> containers;
+    std::vector<std::string> types;
+    bool list;
+    bool latency; // time every batch of steps into a histogram instead of the whole sample
+    std::size_t batch; // steps per latency
+    bool dumpHistograms;
+    bool counters; // hardware counters around every sample, where available
+    bool allocations; // report the heap traffic of the steps
+    bool elementOperations; // report the copies and moves of OperationCountingObject elements
+    bool footprint; // report the memory of filled containers instead of timing operations
+    std::string format; // of the results: text, json or csv
+    std::string output; // file of the results, empty: the standard output
+    std::vector<std::string> replay; // trace files to replay instead of the operations
+    std::vector<std::string> scenarios; // stand-alone workloads to run instead of the operations, see Scenarios.h
+    std::string hotPathTrace; // Chrome Trace file of the container hot path events, empty: none
+    std::vector<std::string> compare; // two result files to compare instead of measuring
+    std::string baseline; // result file to compare the measured results to
+    double threshold; // percent of median growth that is a regression
+    double alpha; // significance level of the regressions
+
+    std::vector<std::size_t> sweep() const
+    {
+        if(!sizes.empty())
+            return sizes;
+        std::vector<std::size_t> swept;
+        for(std::size_t size = minSize; size <= maxSize; size *= sizeFactor)
+        {
+            swept.push_back(size);
+            if(sizeFactor < 2 || size > maxSize / sizeFactor)
+                break;
+        }
+        return swept;
+    }
+};
+
+// One timed run of an operation: steps calls took nanoseconds in total, allocated
+// bytesRequested in allocations blocks and copied and moved OperationCountingObject elements
+// (when the container holds them) as in elementOperations.
+struct Sample
+{
+    double nanoseconds;
+    std::size_t steps;
+    std::uint64_t allocations;
+    std::uint64_t bytesRequested;
+    ElementOperations elementOperations;
+
+    double perStep() const
+    {
+        return steps ? nanoseconds / steps : nanoseconds;
+    }
+};
+
+// Robust summary of the per-step times: the median and the median absolute deviation from it
+// are not dragged by a single preempted sample the way the mean and standard deviation are.
+struct Summary
+{
+    double median;
+    double min;
+    double max;
+    double deviation; // median absolute deviation
+
+    static double medianOf(std::vector<double> values)
+    {
+        if(values.empty())
+            return 0;
+        std::sort(values.begin(), values.end());
+        std::size_t middle = values.size() / 2;
+        return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+    }
+
+    static Summary of(const std::vector<double>& values)
+    {
+        Summary summary { 0, 0, 0, 0 };
+        if(values.empty())
+            return summary;
+        summary.median = medianOf(values);
+        summary.min = *std::min_element(values.begin(), values.end());
+        summary.max = *std::max_element(values.begin(), values.end());
+        std::vector<double> deviations;
+        for(double value : values)
+            deviations.push_back(std::fabs(value - summary.median));
+        summary.deviation = medianOf(deviations);
+        return summary;
+    }
+
+    // the deviation in percent of the median
+    double relativeDeviation() const
+    {
+        return median > 0 ? 100 * deviation / median : 0;
+    }
+};
+
+struct Result
+{
+    std::string operation;
+    std::string container;
+    std::string type;
+    std::size_t size;
+    std::size_t steps;
+    std::vector<double> samples; // nanoseconds per step, one per repetition
+    Summary summary;
+    double baselineRatio; // median over the best baseline median, 0 without baselines
+    Histogram latencies; // nanoseconds per step of every batch of all repetitions, in latency mode
+    std::vector<double> counts; // per step over all repetitions, one per PerfCounters counter
+    double allocationsPerStep; // over all repetitions
+    double bytesPerStep;
+    bool countedElements; // the type is OperationCountingObject, the four below are meaningful
+    double copiesPerStep; // over all repetitions
+    double movesPerStep;
+    double copyAssignmentsPerStep;
+    double moveAssignmentsPerStep;
+};
+
+// What runSample records besides the total time, each optional.
+struct Probes
+{
+    Histogram * latencies;
+    std::size_t batch;
+    PerfCounters * counters;
+};
+
+// the standard containers, run through StdAdapter to compare with
+inline bool isBaseline(const std::string& container)
+{
+    return container.compare(0, 5, "std::") == 0;
+}
+
+// Sets baselineRatio of results, all of one operation, type and size.
+inline void compareToBaselines(std::vector<Result>& results)
+{
+    double best = 0;
+    for(const Result& result : results)
+    {
+        if(isBaseline(result.container) && (best == 0 || result.summary.median < best))
+            best = result.summary.median;
+    }
+    for(Result& result : results)
+        result.baselineRatio = best > 0 ? result.summary.median / best : 0;
+}
+
+// Container is default constructed, Operation prepares it for size elements untimed in
+// setUp(), which returns the number of step() calls to time; both are destroyed untimed.
+// With latencies, every batch of steps is timed on its own with TickClock and recorded as
+// nanoseconds per step: the total then includes the timing overhead of every batch. Counters
+// are started and stopped just outside of the clock readings, so their system calls are
+// not timed.
+template <typename Container, typename Operation>
+Sample runOperation(Operation& operation, std::size_t size, const Probes& probes)
+{
+    Histogram * const latencies = probes.latencies;
+    const std::size_t batch = probes.batch;
+    Deferred<Container> container;
+    container.construct();
+    const std::size_t steps = operation.setUp(*container, size);
+
+    double nanoseconds = 0;
+    const HeapCounts heapBefore = heapCounts();
+    const ElementOperations elementsBefore = OperationCountingObject::counts();
+    if(probes.counters)
+        probes.counters->start();
+    if(latencies == nullptr)
+    {
+        Clock::time_point start = Clock::now();
+        for(std::size_t i = 0; i < steps; ++i)
+            operation.step(*container, i);
+        Clock::time_point end = Clock::now();
+        nanoseconds = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    else
+    {
+        std::uint64_t ticks = 0;
+        for(std::size_t i = 0; i < steps; )
+        {
+            const std::size_t batchEnd = steps - i > batch ? i + batch : steps;
+            const std::size_t batchSteps = batchEnd - i;
+            const std::uint64_t start = TickClock::now();
+            for(; i < batchEnd; ++i)
+                operation.step(*container, i);
+            const std::uint64_t end = TickClock::now();
+            ticks += end - start;
+            latencies->record(static_cast<std::uint64_t>(TickClock::toNanoseconds(end - start) / batchSteps + 0.5));
+        }
+        nanoseconds = TickClock::toNanoseconds(ticks);
+    }
+    if(probes.counters)
+        probes.counters->stop();
+    const HeapCounts heapAfter = heapCounts();
+    const ElementOperations elementsAfter = OperationCountingObject::counts();
+
+    keep(operation);
+    keep(*container);
+    return Sample { nanoseconds, steps, heapAfter.allocations - heapBefore.allocations,
+                    heapAfter.bytesRequested - heapBefore.bytesRequested, elementsAfter - elementsBefore };
+}
+
+// a default constructed Operation
+template <typename Container, typename Operation>
+Sample runSample(std::size_t size, const Probes& probes)
+{
+    Operation operation;
+    return runOperation<Container>(operation, size, probes);
+}
+
+struct Case
+{
+    std::string operation;
+    std::string container;
+    std::string type;
+    bool countedElements;
+    std::function<Sample(std::size_t, const Probes&)> sample;
+
+    // counters is nullptr unless they are wanted and available
+    Result measure(std::size_t size, const Options& options, PerfCounters * counters) const
+    {
+        for(std::size_t i = 0; i < options.warmup; ++i)
+            sample(size, Probes { nullptr, options.batch, nullptr });
+
+        Result result;
+        result.operation = operation;
+        result.container = container;
+        result.type = type;
+        result.size = size;
+        result.steps = 0;
+        result.baselineRatio = 0;
+        result.countedElements = countedElements;
+        if(counters)
+            counters->reset();
+        const Probes probes { options.latency ? &result.latencies : nullptr, options.batch, counters };
+        std::uint64_t allocations = 0;
+        std::uint64_t bytesRequested = 0;
+        ElementOperations elementOperations { 0, 0, 0, 0 };
+        for(std::size_t i = 0; i < options.repetitions; ++i)
+        {
+            Sample taken = sample(size, probes);
+            result.steps = taken.steps;
+            result.samples.push_back(taken.perStep());
+            allocations += taken.allocations;
+            bytesRequested += taken.bytesRequested;
+            elementOperations.copies += taken.elementOperations.copies;
+            elementOperations.moves += taken.elementOperations.moves;
+            elementOperations.copyAssignments += taken.elementOperations.copyAssignments;
+            elementOperations.moveAssignments += taken.elementOperations.moveAssignments;
+        }
+        result.summary = Summary::of(result.samples);
+        const double allSteps = static_cast<double>(result.steps) * options.repetitions;
+        result.allocationsPerStep = allSteps > 0 ? allocations / allSteps : 0;
+        result.bytesPerStep = allSteps > 0 ? bytesRequested / allSteps : 0;
+        result.copiesPerStep = allSteps > 0 ? elementOperations.copies / allSteps : 0;
+        result.movesPerStep = allSteps > 0 ? elementOperations.moves / allSteps : 0;
+        result.copyAssignmentsPerStep = allSteps > 0 ? elementOperations.copyAssignments / allSteps : 0;
+        result.moveAssignmentsPerStep = allSteps > 0 ? elementOperations.moveAssignments / allSteps : 0;
+        for(std::size_t i = 0; counters && i < counters->getSize(); ++i)
+            result.counts.push_back(allSteps > 0 ? counters->getTotal(i) / allSteps : 0);
+        return result;
+    }
+};
+
+class Registry
+{
+public:
+    template <typename Container, typename Operation>
+    void add(const std::string& containerName, const std::string& typeName)
+    {
+        cases.push_back(Case { Operation::name(), containerName, typeName, countsElements<Container>(),
+                               &runSample<Container, Operation> });
+    }
+
+    // a copy of operation for every sample, under the name given (e.g. of the trace it replays)
+    template <typename Container, typename Operation>
+    void add(const std::string& operationName, const std::string& containerName, const std::string& typeName,
+             const Operation& operation)
+    {
+        cases.push_back(Case { operationName, containerName, typeName, countsElements<Container>(),
+                               [operation](std::size_t size, const Probes& probes)
+                               {
+                                   Operation fresh(operation);
+                                   return runOperation<Container>(fresh, size, probes);
+                               } });
+    }
+
+    const std::vector<Case>& getCases() const
+    {
+        return cases;
+    }
+
+private:
+    std::vector<Case> cases;
+
+    template <typename Container>
+    static bool countsElements()
+    {
+        return std::is_same<typename Container::value_type, OperationCountingObject>::value;
+    }
+};
+
+inline bool selected(const std::vector<std::string>& filter, const std::string& name)
+{
+    return filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end();
+}
+
+inline bool selected(const Options& options, const Case& benchmarkCase)
+{
+    return selected(options.operations, benchmarkCase.operation)
+        && selected(options.containers, benchmarkCase.container)
+        && selected(options.types, benchmarkCase.type);
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_HARNESS_H
@@ -0,0 +1,119 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "HeapCounter.h"
+
+namespace
+{
+
+aisdi::bench::HeapCounts counts = { 0, 0, 0, 0, 0 };
+
+// 0 where the allocator does not tell it, then live bytes are not tracked
+std::size_t usableSize(void * block)
+{
+#ifdef __GLIBC__
+    return malloc_usable_size(block);
+#else
+    (void)block;
+    return 0;
+#endif
+}
+
+void * allocate(std::size_t size)
+{
+    void * block = std::malloc(size ? size : 1);
+    if(block)
+    {
+        ++counts.allocations;
+        counts.bytesRequested += size;
+        counts.liveBytes += usableSize(block);
+        if(counts.liveBytes > counts.peakLiveBytes)
+            counts.peakLiveBytes = counts.liveBytes;
+    }
+    return block;
+}
+
+void release(void * block)
+{
+    if(!block)
+        return;
+    ++counts.frees;
+    counts.liveBytes -= usableSize(block);
+    std::free(block);
+}
+
+} // namespace
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+HeapCounts heapCounts()
+{
+    return counts;
+}
+
+void resetHeapPeak()
+{
+    counts.peakLiveBytes = counts.liveBytes;
+}
+
+bool tracksLiveBytes()
+{
+#ifdef __GLIBC__
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::size_t heapHeaderBytes()
+{
+#ifdef __GLIBC__
+    return sizeof(std::size_t);
+#else
+    return 0;
+#endif
+}
+
+void releaseFreeHeap()
+{
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+// operator new[] and delete[] forward to these
+void * operator new(std::size_t size)
+{
+    void * block = allocate(size);
+    if(!block)
+        throw std::bad_alloc();
+    return block;
+}
+
+void * operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void * block) noexcept
+{
+    release(block);
+}
+
+void operator delete(void * block, const std::nothrow_t&) noexcept
+{
+    release(block);
+}
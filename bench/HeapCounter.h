@@ -0,0 +1,46 @@
+#ifndef AISDI_LINEAR_BENCH_HEAPCOUNTER_H
+#define AISDI_LINEAR_BENCH_HEAPCOUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Heap traffic of the whole benchmark binary, counted by the global operator new and delete
+// replaced in HeapCounter.cpp, so that it covers every container alike, the standard ones
+// included. Live bytes are the usable sizes of the blocks (malloc headers excluded, rounding
+// included), tracked with glibc only. Not synchronized: the benchmarks run on one thread.
+struct HeapCounts
+{
+    std::uint64_t allocations;
+    std::uint64_t frees;
+    std::uint64_t bytesRequested;
+    std::uint64_t liveBytes;
+    std::uint64_t peakLiveBytes;
+};
+
+HeapCounts heapCounts();
+
+// lets peakLiveBytes start over from the present liveBytes
+void resetHeapPeak();
+
+// false where the allocator does not tell block sizes, then liveBytes stays 0
+bool tracksLiveBytes();
+
+// Allocator bookkeeping per live block on top of its usable size (the chunk size word of glibc
+// malloc), 0 where unknown.
+std::size_t heapHeaderBytes();
+
+// returns the free pages of the heap to the system (malloc_trim), so that resident memory
+// measured next grows with what is allocated afterwards
+void releaseFreeHeap();
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_HEAPCOUNTER_H
@@ -0,0 +1,146 @@
+#ifndef AISDI_LINEAR_BENCH_HISTOGRAM_H
+#define AISDI_LINEAR_BENCH_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+#include <vector>
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Log-bucketed histogram in the manner of HdrHistogram: values below 2 * subBuckets are counted
+// exactly, above that every power of two is split into subBuckets equal buckets, so that a
+// bucket is at most 1 / subBuckets (about 3%) of its values wide from 1 ns up to 2^64 ns with
+// under two thousand counters. Recording is O(1) and allocation free.
+class Histogram
+{
+public:
+    static const unsigned subBucketBits = 5;
+    static const std::uint64_t subBuckets = std::uint64_t(1) << subBucketBits;
+
+    Histogram() : counts(subBuckets * (64 - subBucketBits + 1), 0), total(0), least(~std::uint64_t(0)), most(0)
+    {
+
+    }
+
+    void record(std::uint64_t value)
+    {
+        ++counts[indexOf(value)];
+        ++total;
+        if(value < least)
+            least = value;
+        if(value > most)
+            most = value;
+    }
+
+    void merge(const Histogram& other)
+    {
+        for(std::size_t i = 0; i < counts.size(); ++i)
+            counts[i] += other.counts[i];
+        total += other.total;
+        if(other.least < least)
+            least = other.least;
+        if(other.most > most)
+            most = other.most;
+    }
+
+    std::uint64_t getCount() const
+    {
+        return total;
+    }
+
+    std::uint64_t getMin() const
+    {
+        return total ? least : 0;
+    }
+
+    std::uint64_t getMax() const
+    {
+        return most;
+    }
+
+    // the least value with at least percentile % of the values not above it, rounded up to the
+    // bucket bound (never above the recorded maximum)
+    std::uint64_t percentile(double percentile) const
+    {
+        if(total == 0)
+            return 0;
+        std::uint64_t wanted = static_cast<std::uint64_t>(percentile / 100 * total + 0.5);
+        if(wanted == 0)
+            wanted = 1;
+        std::uint64_t seen = 0;
+        for(std::size_t i = 0; i < counts.size(); ++i)
+        {
+            seen += counts[i];
+            if(seen >= wanted)
+                return highestOf(i) < most ? highestOf(i) : most;
+        }
+        return most;
+    }
+
+    // one line per non-empty bucket: lowest value, highest value, count, cumulative fraction
+    void dump(std::ostream& stream, const char * linePrefix) const
+    {
+        const std::ios::fmtflags flags = stream.flags();
+        const std::streamsize precision = stream.precision();
+        stream.setf(std::ios::fixed, std::ios::floatfield);
+        stream.precision(6);
+        std::uint64_t seen = 0;
+        for(std::size_t i = 0; i < counts.size(); ++i)
+        {
+            if(counts[i] == 0)
+                continue;
+            seen += counts[i];
+            stream << linePrefix << lowestOf(i) << " " << highestOf(i) << " " << counts[i]
+                   << " " << static_cast<double>(seen) / total << "\n";
+        }
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+
+private:
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total;
+    std::uint64_t least;
+    std::uint64_t most;
+
+    static unsigned highestBit(std::uint64_t value)
+    {
+        return 63 - __builtin_clzll(value);
+    }
+
+    static std::size_t indexOf(std::uint64_t value)
+    {
+        if(value < 2 * subBuckets)
+            return static_cast<std::size_t>(value);
+        const unsigned shift = highestBit(value) - subBucketBits;
+        return static_cast<std::size_t>(subBuckets * shift + (value >> shift));
+    }
+
+    static unsigned shiftOf(std::size_t index)
+    {
+        return index < 2 * subBuckets ? 0 : static_cast<unsigned>(index / subBuckets - 1);
+    }
+
+    static std::uint64_t lowestOf(std::size_t index)
+    {
+        const unsigned shift = shiftOf(index);
+        return (index - subBuckets * shift) << shift;
+    }
+
+    static std::uint64_t highestOf(std::size_t index)
+    {
+        return lowestOf(index) + ((std::uint64_t(1) << shiftOf(index)) - 1);
+    }
+};
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_HISTOGRAM_H
@@ -0,0 +1,431 @@
+#ifndef AISDI_LINEAR_BENCH_OPERATIONS_H
+#define AISDI_LINEAR_BENCH_OPERATIONS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "ElementTypes.h"
+#include "Harness.h"
+#include "StdAdapters.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Every operation measures one public operation of a container holding size elements (append
+// builds it from empty instead). Operations linear in the size on some container (e.g. prepend
+// on Vector) take at most boundedSteps steps, so that the large sizes stay in seconds.
+const std::size_t boundedSteps = 1000;
+
+inline std::size_t atMostBounded(std::size_t size)
+{
+    return size < boundedSteps ? size : boundedSteps;
+}
+
+template <typename Container>
+void fill(Container& container, std::size_t size)
+{
+    using Type = typename Container::value_type;
+    for(std::size_t i = 0; i < size; ++i)
+        container.append(Element<Type>::make(i));
+}
+
+template <typename Container>
+struct AppendOperation
+{
+    using Type = typename Container::value_type;
+
+    static std::string name()
+    {
+        return "append";
+    }
+
+    std::size_t setUp(Container&, std::size_t size)
+    {
+        return size;
+    }
+
+    void step(Container& container, std::size_t i)
+    {
+        container.append(Element<Type>::make(i));
+    }
+};
+
+template <typename Container>
+struct PrependOperation
+{
+    using Type = typename Container::value_type;
+
+    static std::string name()
+    {
+        return "prepend";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return atMostBounded(size);
+    }
+
+    void step(Container& container, std::size_t i)
+    {
+        container.prepend(Element<Type>::make(i));
+    }
+};
+
+// in the middle
+template <typename Container>
+struct InsertOperation
+{
+    using Type = typename Container::value_type;
+
+    static std::string name()
+    {
+        return "insert";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return atMostBounded(size);
+    }
+
+    void step(Container& container, std::size_t i)
+    {
+        container.insert(iteratorAt(container, container.getSize() / 2), Element<Type>::make(i));
+    }
+};
+
+template <typename Container>
+struct PopFirstOperation
+{
+    typename Container::value_type popped;
+
+    static std::string name()
+    {
+        return "popFirst";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return atMostBounded(size);
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        popped = container.popFirst();
+    }
+};
+
+template <typename Container>
+struct PopLastOperation
+{
+    typename Container::value_type popped;
+
+    static std::string name()
+    {
+        return "popLast";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return atMostBounded(size);
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        popped = container.popLast();
+    }
+};
+
+// in the middle
+template <typename Container>
+struct EraseOperation
+{
+    static std::string name()
+    {
+        return "erase";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return atMostBounded(size);
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        container.erase(iteratorAt(container, container.getSize() / 2));
+    }
+};
+
+// the middle half, in one step
+template <typename Container>
+struct EraseRangeOperation
+{
+    static std::string name()
+    {
+        return "eraseRange";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return 1;
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        const std::size_t size = container.getSize();
+        container.erase(iteratorAt(container, size / 4), iteratorAt(container, size / 4 * 3));
+    }
+};
+
+// one step per element: dereference and ++
+template <typename Container>
+struct IterateOperation
+{
+    using ConstIterator = typename Container::const_iterator;
+    using Type = typename Container::value_type;
+    Deferred<ConstIterator> position;
+    std::uint64_t checksum; // of the elements read, keeps the reads
+
+    static std::string name()
+    {
+        return "iterate";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        position.construct(container.cbegin());
+        checksum = 0;
+        return size;
+    }
+
+    void step(Container&, std::size_t)
+    {
+        checksum += Element<Type>::digest(**position);
+        ++*position;
+    }
+};
+
+// one step per element: -- and dereference
+template <typename Container>
+struct IterateReverseOperation
+{
+    using ConstIterator = typename Container::const_iterator;
+    using Type = typename Container::value_type;
+    Deferred<ConstIterator> position;
+    std::uint64_t checksum;
+
+    static std::string name()
+    {
+        return "iterateReverse";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        position.construct(container.cend());
+        checksum = 0;
+        return size;
+    }
+
+    void step(Container&, std::size_t)
+    {
+        --*position;
+        checksum += Element<Type>::digest(**position);
+    }
+};
+
+// begin() + k to scattered positions
+template <typename Container>
+struct AccessOperation
+{
+    using Type = typename Container::value_type;
+    std::uint64_t checksum;
+
+    static std::string name()
+    {
+        return "access";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        checksum = 0;
+        return size ? atMostBounded(size) : 0;
+    }
+
+    void step(Container& container, std::size_t i)
+    {
+        const std::size_t size = container.getSize();
+        checksum += Element<Type>::digest(*iteratorAt(container, (i * 2654435761u) % size));
+    }
+};
+
+template <typename Container>
+struct CopyOperation
+{
+    Deferred<Container> copy;
+
+    static std::string name()
+    {
+        return "copy";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return 1;
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        copy.construct(container);
+    }
+};
+
+// into a container of the same size
+template <typename Container>
+struct CopyAssignOperation
+{
+    Deferred<Container> target;
+
+    static std::string name()
+    {
+        return "copyAssign";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        fill(target.construct(), size);
+        return 1;
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        *target = container;
+    }
+};
+
+template <typename Container>
+struct MoveOperation
+{
+    Deferred<Container> moved;
+
+    static std::string name()
+    {
+        return "move";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        return 1;
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        moved.construct(std::move(container));
+    }
+};
+
+// into a container of the same size, whose elements are released
+template <typename Container>
+struct MoveAssignOperation
+{
+    Deferred<Container> target;
+
+    static std::string name()
+    {
+        return "moveAssign";
+    }
+
+    std::size_t setUp(Container& container, std::size_t size)
+    {
+        fill(container, size);
+        fill(target.construct(), size);
+        return 1;
+    }
+
+    void step(Container& container, std::size_t)
+    {
+        *target = std::move(container);
+    }
+};
+
+template <typename Container>
+struct DestroyOperation
+{
+    Deferred<Container> destroyed;
+
+    static std::string name()
+    {
+        return "destroy";
+    }
+
+    std::size_t setUp(Container&, std::size_t size)
+    {
+        fill(destroyed.construct(), size);
+        return 1;
+    }
+
+    void step(Container&, std::size_t)
+    {
+        destroyed.destroy();
+    }
+};
+
+template <typename Container>
+void addCopyOperations(Registry& registry, const std::string& containerName, const std::string& typeName,
+                       std::true_type)
+{
+    registry.add<Container, CopyOperation<Container>>(containerName, typeName);
+    registry.add<Container, CopyAssignOperation<Container>>(containerName, typeName);
+}
+
+// none for move-only elements
+template <typename Container>
+void addCopyOperations(Registry&, const std::string&, const std::string&, std::false_type)
+{
+
+}
+
+// All of the above for Container; the operations only use the interface shared by Vector,
+// LinkedList and StdAdapter (what only LinkedList has, e.g. splice or sort, is not compared).
+template <typename Container>
+void addOperations(Registry& registry, const std::string& containerName)
+{
+    using Type = typename Container::value_type;
+    const std::string typeName = Element<Type>::name();
+    registry.add<Container, AppendOperation<Container>>(containerName, typeName);
+    registry.add<Container, PrependOperation<Container>>(containerName, typeName);
+    registry.add<Container, InsertOperation<Container>>(containerName, typeName);
+    registry.add<Container, PopFirstOperation<Container>>(containerName, typeName);
+    registry.add<Container, PopLastOperation<Container>>(containerName, typeName);
+    registry.add<Container, EraseOperation<Container>>(containerName, typeName);
+    registry.add<Container, EraseRangeOperation<Container>>(containerName, typeName);
+    registry.add<Container, IterateOperation<Container>>(containerName, typeName);
+    registry.add<Container, IterateReverseOperation<Container>>(containerName, typeName);
+    registry.add<Container, AccessOperation<Container>>(containerName, typeName);
+    addCopyOperations<Container>(registry, containerName, typeName, std::is_copy_constructible<Type>());
+    registry.add<Container, MoveOperation<Container>>(containerName, typeName);
+    registry.add<Container, MoveAssignOperation<Container>>(containerName, typeName);
+    registry.add<Container, DestroyOperation<Container>>(containerName, typeName);
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_OPERATIONS_H
@@ -0,0 +1,160 @@
+#ifndef AISDI_LINEAR_BENCH_PERFCOUNTERS_H
+#define AISDI_LINEAR_BENCH_PERFCOUNTERS_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Hardware counters of this thread (user space only) read through perf_event_open(2) around
+// a measured region. Every counter is opened on its own, so that a PMU lacking one event (or
+// lacking slots for all of them, then the kernel multiplexes and the counts are scaled) still
+// gives the others. Where none can be opened (no PMU in a VM, perf_event_paranoid above 2, not
+// Linux) isAvailable() is false and the benchmarks report time only.
+class PerfCounters
+{
+public:
+    PerfCounters()
+    {
+#ifdef __linux__
+        open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open("instr", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open("L1dMiss", PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_L1D));
+        open("LLCMiss", PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_LL));
+        open("brMiss", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        open("dTLBMiss", PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_DTLB));
+#else
+        failure = "perf_event_open is Linux only";
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters()
+    {
+#ifdef __linux__
+        for(const Counter& counter : counters)
+            close(counter.descriptor);
+#endif
+    }
+
+    bool isAvailable() const
+    {
+        return !counters.empty();
+    }
+
+    // why the first counter failed to open, empty if none failed
+    const std::string& getFailure() const
+    {
+        return failure;
+    }
+
+    std::size_t getSize() const
+    {
+        return counters.size();
+    }
+
+    const std::string& getName(std::size_t counter) const
+    {
+        return counters[counter].name;
+    }
+
+    // the scaled count accumulated since reset() over all start()/stop() regions
+    double getTotal(std::size_t counter) const
+    {
+        return counters[counter].total;
+    }
+
+    void reset()
+    {
+        for(Counter& counter : counters)
+            counter.total = 0;
+    }
+
+    void start()
+    {
+#ifdef __linux__
+        for(const Counter& counter : counters)
+        {
+            ioctl(counter.descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(counter.descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop()
+    {
+#ifdef __linux__
+        for(const Counter& counter : counters)
+            ioctl(counter.descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        for(Counter& counter : counters)
+        {
+            std::uint64_t values[3] = { 0, 0, 0 }; // value, time enabled, time running
+            if(read(counter.descriptor, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)))
+                continue;
+            if(values[2] > 0)
+                counter.total += static_cast<double>(values[0]) * values[1] / values[2];
+        }
+#endif
+    }
+
+private:
+    struct Counter
+    {
+        std::string name;
+        int descriptor;
+        double total;
+    };
+
+    std::vector<Counter> counters;
+    std::string failure;
+
+#ifdef __linux__
+    static std::uint64_t cacheReadMiss(std::uint64_t cache)
+    {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    void open(const char * name, std::uint32_t type, std::uint64_t config)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        long descriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+        if(descriptor < 0)
+        {
+            if(failure.empty())
+                failure = std::string(name) + ": " + std::strerror(errno);
+            return;
+        }
+        counters.push_back(Counter { name, static_cast<int>(descriptor), 0 });
+    }
+#endif
+};
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_PERFCOUNTERS_H
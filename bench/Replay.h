@@ -0,0 +1,183 @@
+#ifndef AISDI_LINEAR_BENCH_REPLAY_H
+#define AISDI_LINEAR_BENCH_REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "Trace.h"
+
+#include "ElementTypes.h"
+#include "Harness.h"
+#include "StdAdapters.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+inline Trace loadTrace(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+        throw std::runtime_error("Cannot read " + path);
+    return readTrace(file);
+}
+
+// the name of the file without directories and extension
+inline std::string traceName(const std::string& path)
+{
+    const std::size_t slash = path.find_last_of("/\\");
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    const std::size_t dot = name.find_last_of('.');
+    return dot == std::string::npos || dot == 0 ? name : name.substr(0, dot);
+}
+
+// What replaying a trace from an empty container amounts to. Throws std::out_of_range for a
+// position or pop the sizes at that moment do not allow, so that a broken trace is rejected
+// before any container replays it.
+struct TraceShape
+{
+    std::uint64_t steps; // events with their repeats
+    std::uint64_t peakSize;
+    std::uint64_t finalSize;
+
+    static TraceShape of(const Trace& trace)
+    {
+        TraceShape shape { 0, 0, 0 };
+        std::uint64_t size = 0;
+        std::size_t number = 0;
+        for(const TraceEvent& event : trace)
+        {
+            ++number;
+            const std::string where = "Trace event " + std::to_string(number) + " (" + traceOperationName(event.operation)
+                + ")";
+            switch(event.operation)
+            {
+            case TraceOperation::append:
+            case TraceOperation::prepend:
+                size += event.repeat;
+                break;
+            case TraceOperation::insert:
+                if(event.repeat > 0 && event.argument > size)
+                    throw std::out_of_range(where + " beyond the end");
+                size += event.repeat;
+                break;
+            case TraceOperation::erase:
+                if(event.repeat > 0 && (size < event.repeat || event.argument > size - event.repeat))
+                    throw std::out_of_range(where + " beyond the end");
+                size -= event.repeat;
+                break;
+            case TraceOperation::popFirst:
+            case TraceOperation::popLast:
+                if(size < event.repeat)
+                    throw std::out_of_range(where + " on an empty container");
+                size -= event.repeat;
+                break;
+            case TraceOperation::iterate:
+                break;
+            }
+            shape.steps += event.repeat;
+            if(size > shape.peakSize)
+                shape.peakSize = size;
+        }
+        shape.finalSize = size;
+        return shape;
+    }
+};
+
+// Replays a trace from an empty container, one step per event repeat; the i-th step stores
+// Element::make(i) where it adds an element. The trace has to be checked with TraceShape.
+template <typename Container>
+class ReplayOperation
+{
+public:
+    using Type = typename Container::value_type;
+
+    explicit ReplayOperation(const Trace& trace) : trace(&trace), event(0), repeated(0), last(), checksum(0)
+    {
+
+    }
+
+    // a fresh cursor over the same trace, whatever the elements (move-only ones too)
+    ReplayOperation(const ReplayOperation& other) : trace(other.trace), event(0), repeated(0), last(), checksum(0)
+    {
+
+    }
+
+    ReplayOperation& operator=(const ReplayOperation&) = delete;
+
+    std::size_t setUp(Container&, std::size_t)
+    {
+        event = 0;
+        repeated = 0;
+        return static_cast<std::size_t>(TraceShape::of(*trace).steps);
+    }
+
+    void step(Container& container, std::size_t i)
+    {
+        while((*trace)[event].repeat == 0)
+            ++event;
+        const TraceEvent& current = (*trace)[event];
+        const std::size_t argument = static_cast<std::size_t>(current.argument);
+        switch(current.operation)
+        {
+        case TraceOperation::append:
+            container.append(Element<Type>::make(i));
+            break;
+        case TraceOperation::prepend:
+            container.prepend(Element<Type>::make(i));
+            break;
+        case TraceOperation::insert:
+            container.insert(iteratorAt(container, argument), Element<Type>::make(i));
+            break;
+        case TraceOperation::erase:
+            container.erase(iteratorAt(container, argument));
+            break;
+        case TraceOperation::popFirst:
+            last = container.popFirst();
+            break;
+        case TraceOperation::popLast:
+            last = container.popLast();
+            break;
+        case TraceOperation::iterate:
+            iterate(container, argument);
+            break;
+        }
+        if(++repeated == current.repeat)
+        {
+            ++event;
+            repeated = 0;
+        }
+    }
+
+private:
+    const Trace * trace;
+    std::size_t event;
+    std::uint64_t repeated; // steps done of the event
+    Type last; // popped
+    std::uint64_t checksum; // of the elements iterated over
+
+    void iterate(const Container& container, std::size_t count)
+    {
+        std::size_t visited = 0;
+        for(auto position = container.cbegin(); visited < count && position != container.cend(); ++position, ++visited)
+            checksum += Element<Type>::digest(*position);
+    }
+};
+
+template <typename Container>
+void addReplay(Registry& registry, const std::string& containerName, const std::string& traceName, const Trace& trace)
+{
+    registry.add<Container>("replay:" + traceName, containerName, Element<typename Container::value_type>::name(),
+                            ReplayOperation<Container>(trace));
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_REPLAY_H
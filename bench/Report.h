@@ -0,0 +1,385 @@
+#ifndef AISDI_LINEAR_BENCH_REPORT_H
+#define AISDI_LINEAR_BENCH_REPORT_H
+
+#include <cstddef>
+#include <iomanip>
+#include <ios>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BuildInfo.h"
+#include "Harness.h"
+#include "PerfCounters.h"
+#include "TickClock.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+enum class Format
+{
+    text,
+    json,
+    csv
+};
+
+inline Format parseFormat(const std::string& name)
+{
+    if(name == "text")
+        return Format::text;
+    if(name == "json")
+        return Format::json;
+    if(name == "csv")
+        return Format::csv;
+    throw std::invalid_argument("Unknown format: " + name);
+}
+
+// Writes the results as they are measured: an aligned table for reading, or records for tools.
+// JSON is one object with the build information and a "results" array, CSV is one line per
+// result repeating the build information, so that files of several versions can be
+// concatenated. Both have the same field names (times in ns per step), and both can be read
+// back by Compare.h.
+class Report
+{
+public:
+    // counters is nullptr unless they are wanted and available
+    Report(std::ostream& out, Format format, const Options& options, const PerfCounters * counters)
+        : out(out), format(format), options(options), counters(counters), written(0)
+    {
+
+    }
+
+    Report(const Report&) = delete;
+    Report& operator=(const Report&) = delete;
+
+    void begin()
+    {
+        if(format == Format::text)
+            beginText();
+        else if(format == Format::json)
+            beginJson();
+        else
+            beginCsv();
+    }
+
+    void add(const Result& result)
+    {
+        if(format == Format::text)
+            addText(result);
+        else if(format == Format::json)
+            addJson(result);
+        else
+            addCsv(result);
+        ++written;
+    }
+
+    void end()
+    {
+        if(format == Format::json)
+            out << "\n  ]\n}\n";
+        out.flush();
+    }
+
+private:
+    std::ostream& out;
+    const Format format;
+    const Options& options;
+    const PerfCounters * const counters;
+    std::size_t written;
+
+    std::size_t counterCount() const
+    {
+        return counters ? counters->getSize() : 0;
+    }
+
+    void beginText()
+    {
+        if(!BuildInfo::isOptimized())
+            out << "# built without optimization, build the Release configuration for meaningful times\n";
+        if(options.latency)
+        {
+            out << "# latencies in ns per step of batches of " << options.batch << ", timer overhead "
+                << std::fixed << std::setprecision(1) << TickClock::overhead() << " ns per batch";
+            if(options.dumpHistograms)
+                out << "; histogram lines: lowest highest count cumulative-fraction";
+            out << "\n";
+        }
+        if(counters)
+            out << "# counters per step, user space only\n";
+        out << std::left << std::setw(15) << "operation" << " " << std::setw(13) << "container"
+            << std::setw(11) << "type" << std::right << std::setw(10) << "size" << std::setw(10) << "steps";
+        if(options.latency)
+        {
+            out << std::setw(10) << "p50 ns" << std::setw(10) << "p90 ns" << std::setw(10) << "p99 ns"
+                << std::setw(10) << "p99.9 ns" << std::setw(12) << "max ns";
+        }
+        else
+        {
+            out << std::setw(14) << "median ns" << std::setw(12) << "min ns" << std::setw(12) << "max ns"
+                << std::setw(8) << "MAD %" << std::setw(11) << "vs std";
+        }
+        if(options.allocations)
+            out << std::setw(11) << "allocs" << std::setw(11) << "bytes";
+        if(options.elementOperations)
+            out << std::setw(9) << "copies" << std::setw(9) << "moves" << std::setw(9) << "copy=" << std::setw(9) << "move=";
+        for(std::size_t i = 0; i < counterCount(); ++i)
+            out << std::setw(11) << counters->getName(i);
+        out << "\n";
+    }
+
+    void addText(const Result& result)
+    {
+        out << std::left << std::setw(15) << result.operation << " " << std::setw(13) << result.container
+            << std::setw(11) << result.type << std::right << std::setw(10) << result.size
+            << std::setw(10) << result.steps << std::fixed;
+        if(options.latency)
+        {
+            const Histogram& latencies = result.latencies;
+            out << std::setw(10) << latencies.percentile(50) << std::setw(10) << latencies.percentile(90)
+                << std::setw(10) << latencies.percentile(99) << std::setw(10) << latencies.percentile(99.9)
+                << std::setw(12) << latencies.getMax();
+        }
+        else
+        {
+            out << std::setprecision(2) << std::setw(14) << result.summary.median
+                << std::setw(12) << result.summary.min << std::setw(12) << result.summary.max
+                << std::setprecision(1) << std::setw(8) << result.summary.relativeDeviation();
+            if(result.baselineRatio > 0) // how many times slower than the fastest standard container
+                out << std::setprecision(2) << std::setw(10) << result.baselineRatio << "x";
+            else if(options.allocations || options.elementOperations || !result.counts.empty())
+                out << std::setw(11) << "";
+        }
+        if(options.allocations)
+        {
+            out << std::setprecision(2) << std::setw(11) << result.allocationsPerStep
+                << std::setw(11) << result.bytesPerStep;
+        }
+        if(options.elementOperations && result.countedElements)
+        {
+            out << std::setprecision(2) << std::setw(9) << result.copiesPerStep << std::setw(9) << result.movesPerStep
+                << std::setw(9) << result.copyAssignmentsPerStep << std::setw(9) << result.moveAssignmentsPerStep;
+        }
+        else if(options.elementOperations) // not counted
+            out << std::setw(9) << "-" << std::setw(9) << "-" << std::setw(9) << "-" << std::setw(9) << "-";
+        for(double count : result.counts)
+            out << std::setprecision(2) << std::setw(11) << count;
+        out << std::endl;
+        if(options.dumpHistograms)
+            result.latencies.dump(out, "#   ");
+    }
+
+    void writeString(const std::string& text)
+    {
+        out << '"';
+        for(char c : text)
+        {
+            if(c == '"' || c == '\\')
+                out << '\\' << c;
+            else if(static_cast<unsigned char>(c) < 0x20)
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                    << std::dec << std::setfill(' ');
+            else
+                out << c;
+        }
+        out << '"';
+    }
+
+    void writeField(const char * name, const std::string& value)
+    {
+        out << "\"" << name << "\": ";
+        writeString(value);
+    }
+
+    template <typename Number>
+    void writeField(const char * name, Number value)
+    {
+        out << "\"" << name << "\": " << value;
+    }
+
+    void beginJson()
+    {
+        out.unsetf(std::ios::floatfield);
+        out << std::setprecision(9) << std::boolalpha << "{\n  ";
+        writeField("benchmark", std::string("aisdiLinearBench"));
+        out << ",\n  ";
+        writeField("revision", std::string(BuildInfo::revision()));
+        out << ",\n  ";
+        writeField("compiler", std::string(BuildInfo::compiler()));
+        out << ",\n  ";
+        writeField("flags", std::string(BuildInfo::flags()));
+        out << ",\n  ";
+        writeField("buildType", std::string(BuildInfo::buildType()));
+        out << ",\n  ";
+        writeField("optimized", BuildInfo::isOptimized());
+        out << ",\n  ";
+        writeField("repetitions", options.repetitions);
+        out << ",\n  ";
+        writeField("warmup", options.warmup);
+        out << ",\n  \"results\": [";
+    }
+
+    void addJson(const Result& result)
+    {
+        out << (written ? ",\n    {" : "\n    {");
+        writeField("operation", result.operation);
+        out << ", ";
+        writeField("container", result.container);
+        out << ", ";
+        writeField("type", result.type);
+        out << ", ";
+        writeField("size", result.size);
+        out << ", ";
+        writeField("steps", result.steps);
+        out << ",\n     ";
+        writeField("medianNs", result.summary.median);
+        out << ", ";
+        writeField("minNs", result.summary.min);
+        out << ", ";
+        writeField("maxNs", result.summary.max);
+        out << ", ";
+        writeField("madNs", result.summary.deviation);
+        out << ", \"vsStd\": ";
+        if(result.baselineRatio > 0)
+            out << result.baselineRatio;
+        else
+            out << "null";
+        out << ",\n     \"samplesNs\": [";
+        for(std::size_t i = 0; i < result.samples.size(); ++i)
+            out << (i ? ", " : "") << result.samples[i];
+        out << "]";
+        if(options.latency)
+        {
+            const Histogram& latencies = result.latencies;
+            out << ",\n     \"latencyNs\": {";
+            writeField("p50", latencies.percentile(50));
+            out << ", ";
+            writeField("p90", latencies.percentile(90));
+            out << ", ";
+            writeField("p99", latencies.percentile(99));
+            out << ", ";
+            writeField("p99.9", latencies.percentile(99.9));
+            out << ", ";
+            writeField("max", latencies.getMax());
+            out << "}";
+        }
+        if(options.allocations)
+        {
+            out << ",\n     ";
+            writeField("allocationsPerStep", result.allocationsPerStep);
+            out << ", ";
+            writeField("bytesPerStep", result.bytesPerStep);
+        }
+        if(options.elementOperations && result.countedElements)
+        {
+            out << ",\n     \"elementOperationsPerStep\": {";
+            writeField("copies", result.copiesPerStep);
+            out << ", ";
+            writeField("moves", result.movesPerStep);
+            out << ", ";
+            writeField("copyAssignments", result.copyAssignmentsPerStep);
+            out << ", ";
+            writeField("moveAssignments", result.moveAssignmentsPerStep);
+            out << "}";
+        }
+        if(!result.counts.empty())
+        {
+            out << ",\n     \"counters\": {";
+            for(std::size_t i = 0; i < result.counts.size(); ++i)
+            {
+                out << (i ? ", " : "");
+                writeField(counters->getName(i).c_str(), result.counts[i]);
+            }
+            out << "}";
+        }
+        out << "}";
+    }
+
+    // Quoted when it has a separator or a quote, as RFC 4180 has it.
+    void writeCsvField(const std::string& value)
+    {
+        if(value.find_first_of(",\"\n") == std::string::npos)
+        {
+            out << value;
+            return;
+        }
+        out << '"';
+        for(char c : value)
+            out << (c == '"' ? "\"\"" : std::string(1, c));
+        out << '"';
+    }
+
+    void beginCsv()
+    {
+        out.unsetf(std::ios::floatfield);
+        out << std::setprecision(9)
+            << "operation,container,type,size,steps,medianNs,minNs,maxNs,madNs,vsStd,samplesNs,"
+               "p50Ns,p90Ns,p99Ns,p99.9Ns,maxLatencyNs,allocationsPerStep,bytesPerStep,copiesPerStep,movesPerStep,"
+               "copyAssignmentsPerStep,moveAssignmentsPerStep";
+        for(std::size_t i = 0; i < counterCount(); ++i)
+            out << "," << counters->getName(i);
+        out << ",revision,compiler,flags,buildType,optimized\n";
+    }
+
+    void addCsv(const Result& result)
+    {
+        writeCsvField(result.operation);
+        out << ",";
+        writeCsvField(result.container);
+        out << ",";
+        writeCsvField(result.type);
+        out << "," << result.size << "," << result.steps << "," << result.summary.median << ","
+            << result.summary.min << "," << result.summary.max << "," << result.summary.deviation << ",";
+        if(result.baselineRatio > 0)
+            out << result.baselineRatio;
+        out << ",";
+        for(std::size_t i = 0; i < result.samples.size(); ++i)
+            out << (i ? ";" : "") << result.samples[i];
+        out << ",";
+        if(options.latency)
+        {
+            const Histogram& latencies = result.latencies;
+            out << latencies.percentile(50) << "," << latencies.percentile(90) << ","
+                << latencies.percentile(99) << "," << latencies.percentile(99.9) << "," << latencies.getMax();
+        }
+        else
+            out << ",,,,";
+        out << ",";
+        if(options.allocations)
+            out << result.allocationsPerStep << "," << result.bytesPerStep;
+        else
+            out << ",";
+        out << ",";
+        if(options.elementOperations && result.countedElements) // empty for the types not counted
+        {
+            out << result.copiesPerStep << "," << result.movesPerStep << "," << result.copyAssignmentsPerStep << ","
+                << result.moveAssignmentsPerStep;
+        }
+        else
+            out << ",,,";
+        for(std::size_t i = 0; i < counterCount(); ++i)
+        {
+            out << ",";
+            if(i < result.counts.size())
+                out << result.counts[i];
+        }
+        out << ",";
+        writeCsvField(BuildInfo::revision());
+        out << ",";
+        writeCsvField(BuildInfo::compiler());
+        out << ",";
+        writeCsvField(BuildInfo::flags());
+        out << ",";
+        writeCsvField(BuildInfo::buildType());
+        out << "," << (BuildInfo::isOptimized() ? "true" : "false") << "\n";
+    }
+};
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_REPORT_H
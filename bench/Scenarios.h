@@ -0,0 +1,834 @@
+#ifndef AISDI_LINEAR_BENCH_SCENARIOS_H
+#define AISDI_LINEAR_BENCH_SCENARIOS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CompactLinkedList.h"
+#include "ForwardList.h"
+#include "LinkedList.h"
+#include "LruCache.h"
+#include "PriorityQueue.h"
+#include "SlotMap.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Stand-alone workloads comparing a container feature against what it replaces (positional
+// jumps, compact nodes, defragment(), payload policies, handles, the value index...), printed
+// as text. Unlike the operations they are not repeated, compared or exported; see --scenario.
+
+inline void performPositionalAccessTest(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    LinkedList<std::size_t> collection;
+    std::cout << "LinkedList positional access:\n";
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        collection.append(i);
+    }
+
+    // std::next only knows operator++, so it walks from begin() like operator+ used to
+    std::size_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        checksum += *std::next(collection.begin(), i);
+    }
+    end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> timeTaken = end - start;
+    std::cout << "Sequential access to " << n << " elements walking from begin() takes: " << timeTaken.count() << "s\n";
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        checksum += *(collection.begin() + i);
+    }
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "Sequential access to " << n << " elements with begin() + i takes: " << timeTaken.count() << "s\n";
+
+    // random jumps of up to 16 positions around a slowly moving centre
+    std::size_t seed = 1;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        std::size_t position = i + (seed >> 60) < n ? i + (seed >> 60) : i;
+        checksum += *std::next(collection.begin(), position);
+    }
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "Locally random access to " << n << " elements walking from begin() takes: " << timeTaken.count() << "s\n";
+
+    seed = 1;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        std::size_t position = i + (seed >> 60) < n ? i + (seed >> 60) : i;
+        checksum += *(collection.begin() + position);
+    }
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "Locally random access to " << n << " elements with begin() + i takes: " << timeTaken.count() << "s\n";
+    std::cout << "(checksum " << checksum << ")\n";
+}
+
+template <typename List>
+std::int64_t sumOf(const List& collection)
+{
+    std::int64_t sum = 0;
+    for(auto it = collection.begin(); it != collection.end(); ++it)
+    {
+        sum += *it;
+    }
+    return sum;
+}
+
+// builds the list from both ends and churns it, so that list order and memory order differ
+template <typename List>
+void fillScattered(List& collection, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(i % 2)
+            collection.append(static_cast<std::int32_t>(i));
+        else
+            collection.prepend(static_cast<std::int32_t>(i));
+    }
+    for(std::size_t i = 0; i < n / 2; ++i)
+    {
+        collection.append(collection.popFirst());
+    }
+}
+
+inline void performCompactListTest(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    std::chrono::duration<double> timeTaken;
+    std::cout << "LinkedList vs CompactLinkedList of int32_t:\n";
+
+    LinkedList<std::int32_t> collection;
+    start = std::chrono::steady_clock::now();
+    fillScattered(collection, n);
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "LinkedList: building " << n << " elements takes: " << timeTaken.count() << "s\n";
+
+    start = std::chrono::steady_clock::now();
+    std::int64_t checksum = sumOf(collection);
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "LinkedList: traversing " << n << " elements takes: " << timeTaken.count() << "s\n";
+
+    aisdi::CompactLinkedList<std::int32_t> compactCollection;
+    start = std::chrono::steady_clock::now();
+    fillScattered(compactCollection, n);
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "CompactLinkedList: building " << n << " elements takes: " << timeTaken.count() << "s\n";
+
+    start = std::chrono::steady_clock::now();
+    checksum += sumOf(compactCollection);
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "CompactLinkedList: traversing " << n << " elements takes: " << timeTaken.count() << "s\n";
+
+    start = std::chrono::steady_clock::now();
+    compactCollection.compact();
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "CompactLinkedList: compact() of " << n << " elements takes: " << timeTaken.count() << "s\n";
+
+    start = std::chrono::steady_clock::now();
+    checksum += sumOf(compactCollection);
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "CompactLinkedList: traversing " << n << " compacted elements takes: " << timeTaken.count() << "s\n";
+    std::cout << "(checksum " << checksum << ")\n";
+}
+
+// Best of a few traversals after an untimed one, so that the first touch of the nodes and a cold
+// cache are not counted: what is left differs by memory layout only.
+template <typename List>
+double warmTraversalSeconds(const List& collection, std::int64_t& checksum)
+{
+    checksum += sumOf(collection);
+    double best = 0;
+    for(int run = 0; run < 5; ++run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        checksum += sumOf(collection);
+        std::chrono::duration<double> timeTaken = std::chrono::steady_clock::now() - start;
+        if(run == 0 || timeTaken.count() < best)
+            best = timeTaken.count();
+    }
+    return best;
+}
+
+inline void performDefragmentTest(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    std::chrono::duration<double> timeTaken;
+    LinkedList<std::int32_t> collection;
+    std::cout << "LinkedList defragment:\n";
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        collection.append(static_cast<std::int32_t>(i));
+    }
+
+    std::int64_t checksum = 0;
+    std::cout << "Traversing " << n << " freshly appended elements takes: " << warmTraversalSeconds(collection, checksum) << "s\n";
+
+    // ageing: erases at one wandering position and inserts at another, so freed nodes are reused far away
+    std::size_t seed = 1;
+    auto eraseAt = collection.begin();
+    auto insertAt = collection.begin();
+    for(std::size_t i = 0; i < 4 * n; ++i)
+    {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        for(std::size_t steps = seed >> 59; steps > 0; --steps)
+        {
+            if(++eraseAt == collection.end())
+                eraseAt = collection.begin();
+        }
+        for(std::size_t steps = (seed >> 54) & 31; steps > 0; --steps)
+        {
+            if(++insertAt == collection.end())
+                insertAt = collection.begin();
+        }
+        if(eraseAt == insertAt)
+            continue;
+        auto erased = eraseAt++;
+        if(eraseAt == collection.end())
+            eraseAt = collection.begin();
+        collection.erase(erased);
+        collection.insert(insertAt, static_cast<std::int32_t>(i));
+    }
+
+    std::cout << "Traversing " << n << " elements after ageing takes: " << warmTraversalSeconds(collection, checksum) << "s\n";
+
+    start = std::chrono::steady_clock::now();
+    collection.defragment();
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "defragment() of " << n << " elements takes: " << timeTaken.count() << "s\n";
+
+    std::cout << "Traversing " << n << " elements after defragment() takes: " << warmTraversalSeconds(collection, checksum) << "s\n";
+    std::cout << "(checksum " << checksum << ")\n";
+}
+
+template <std::size_t Size>
+struct Blob
+{
+    Blob(std::int32_t initKey = 0) : key(initKey)
+    {
+
+    }
+    std::int32_t key;
+    char padding[Size - sizeof(std::int32_t)];
+};
+
+template <>
+struct Blob<sizeof(std::int32_t)>
+{
+    Blob(std::int32_t initKey = 0) : key(initKey)
+    {
+
+    }
+    std::int32_t key;
+};
+
+// the list is sorted by a hash of the keys, so that consecutive nodes are far apart in memory
+template <typename List>
+void fillShuffled(List& collection, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        collection.append(static_cast<std::int32_t>(i));
+    }
+    collection.sort([](const typename List::value_type& a, const typename List::value_type& b)
+    {
+        return static_cast<std::uint32_t>(a.key) * 2654435761u < static_cast<std::uint32_t>(b.key) * 2654435761u;
+    });
+}
+
+template <std::size_t Size, typename Payload>
+void performPayloadTraversal(std::size_t n, const char* payloadName)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    std::chrono::duration<double> timeTaken;
+    aisdi::LinkedList<Blob<Size>, Payload> collection;
+    fillShuffled(collection, n);
+
+    std::int64_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for(auto it = collection.begin(); it != collection.end(); ++it)
+    {
+        checksum += (*it).key;
+    }
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << Size << "B " << payloadName << ": iterating takes: " << timeTaken.count() << "s, ";
+
+    start = std::chrono::steady_clock::now();
+    collection.forEach([&checksum](const Blob<Size>& item) { checksum += item.key; }, 0);
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "forEach without prefetching takes: " << timeTaken.count() << "s, ";
+
+    start = std::chrono::steady_clock::now();
+    collection.forEach([&checksum](const Blob<Size>& item) { checksum += item.key; });
+    end = std::chrono::steady_clock::now();
+    timeTaken = end - start;
+    std::cout << "forEach takes: " << timeTaken.count() << "s (checksum " << checksum << ")\n";
+}
+
+template <std::size_t Size>
+void performPayloadTraversals(std::size_t n)
+{
+    performPayloadTraversal<Size, aisdi::InlinePayload>(n, "inline");
+    performPayloadTraversal<Size, aisdi::OutOfLinePayload>(n, "out of line");
+}
+
+inline void performPayloadTest(std::size_t n)
+{
+    std::cout << "LinkedList traversal of " << n << " shuffled elements by payload size:\n";
+    performPayloadTraversals<4>(n);
+    performPayloadTraversals<16>(n);
+    performPayloadTraversals<64>(n);
+    performPayloadTraversals<128>(n);
+    performPayloadTraversals<256>(n);
+    performPayloadTraversals<512>(n);
+}
+
+// append/popFirst only: fills the queue, keeps it at n elements for 4n steps, drains it
+template <typename Queue>
+void performQueueWorkload(std::size_t n, const char* name)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    Queue queue;
+    std::size_t checksum = 0;
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        queue.append(i);
+    }
+    for(std::size_t i = 0; i < 4 * n; ++i)
+    {
+        checksum += queue.popFirst();
+        queue.append(i);
+    }
+    while(!queue.isEmpty())
+    {
+        checksum += queue.popFirst();
+    }
+    end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> timeTaken = end - start;
+    std::cout << name << ": queue of " << n << " elements, " << 6 * n << " operations take: " << timeTaken.count()
+              << "s (checksum " << checksum << ")\n";
+}
+
+inline void performQueueTest(std::size_t n)
+{
+    std::cout << "LinkedList vs ForwardList as a queue:\n";
+    performQueueWorkload<LinkedList<std::size_t>>(n, "LinkedList");
+    performQueueWorkload<aisdi::ForwardList<std::size_t>>(n, "ForwardList");
+}
+
+// keys 0..universe-1 drawn with probability proportional to 1 / (rank + 1)^0.99, as in caching studies
+inline std::vector<std::uint32_t> zipfKeys(std::size_t universe, std::size_t count)
+{
+    std::vector<double> cumulative(universe);
+    double sum = 0;
+    for(std::size_t rank = 0; rank < universe; ++rank)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(rank + 1), 0.99);
+        cumulative[rank] = sum;
+    }
+    std::vector<std::uint32_t> keys(count);
+    std::uint64_t state = 88172645463325252ull;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double u = static_cast<double>(state >> 11) / 9007199254740992.0 * sum;
+        keys[i] = static_cast<std::uint32_t>(std::lower_bound(cumulative.begin(), cumulative.end(), u) - cumulative.begin());
+    }
+    return keys;
+}
+
+inline void reportCacheRun(const char* name, const std::vector<std::uint32_t>& keys, std::size_t hits,
+                           std::chrono::duration<double> timeTaken)
+{
+    std::cout << name << ": " << keys.size() << " requests take: " << timeTaken.count() << "s ("
+              << keys.size() / timeTaken.count() / 1e6 << " M requests/s, hit ratio "
+              << static_cast<double>(hits) / keys.size() << ")\n";
+}
+
+// what the cache replaces: LRU order in a LinkedList, found by a linear search
+inline std::size_t linearSearchLru(const std::vector<std::uint32_t>& keys, std::size_t capacity)
+{
+    LinkedList<std::uint32_t> recent;
+    std::size_t hits = 0;
+    for(std::size_t i = 0; i < keys.size(); ++i)
+    {
+        auto it = recent.begin();
+        while(it != recent.end() && *it != keys[i])
+        {
+            ++it;
+        }
+        if(it != recent.end())
+        {
+            ++hits;
+            recent.erase(it);
+        }
+        else if(recent.getSize() == capacity)
+        {
+            recent.popLast();
+        }
+        recent.prepend(keys[i]);
+    }
+    return hits;
+}
+
+inline void performLruCacheTest(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    const std::size_t capacity = std::max<std::size_t>(n / 10, 1);
+    const std::vector<std::uint32_t> keys = zipfKeys(n, 10 * n);
+    std::cout << "LRU cache of " << capacity << " entries, Zipf(0.99) keys out of " << n << ":\n";
+
+    aisdi::LruCache<std::uint32_t, std::uint64_t> cache(capacity);
+    std::size_t hits = 0;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < keys.size(); ++i)
+    {
+        if(cache.get(keys[i]))
+        {
+            ++hits;
+        }
+        else
+        {
+            cache.put(keys[i], keys[i]);
+        }
+    }
+    end = std::chrono::steady_clock::now();
+    reportCacheRun("LruCache get/put", keys, hits, end - start);
+
+    const std::size_t batch = 16;
+    aisdi::LruCache<std::uint32_t, std::uint64_t> batchedCache(capacity);
+    std::uint64_t * values[batch];
+    hits = 0;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < keys.size(); i += batch)
+    {
+        const std::size_t count = std::min(batch, keys.size() - i);
+        hits += batchedCache.getMany(&keys[i], count, values);
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            if(!values[j])
+            {
+                batchedCache.put(keys[i + j], keys[i + j]);
+            }
+        }
+    }
+    end = std::chrono::steady_clock::now();
+    reportCacheRun("LruCache getMany/put", keys, hits, end - start);
+
+    if(capacity > 1000)
+    {
+        std::cout << "linear search LRU: skipped, quadratic at this size\n";
+        return;
+    }
+    start = std::chrono::steady_clock::now();
+    hits = linearSearchLru(keys, capacity);
+    end = std::chrono::steady_clock::now();
+    reportCacheRun("linear search LRU", keys, hits, end - start);
+}
+
+// per operation, in nanoseconds
+inline double nanosecondsPer(std::chrono::duration<double> timeTaken, std::size_t operations)
+{
+    return timeTaken.count() * 1e9 / operations;
+}
+
+// the keys 0..size-1 in an order unrelated to the list order
+inline std::uint32_t scrambledKey(std::size_t i, std::size_t size)
+{
+    return static_cast<std::uint32_t>((i * 2654435761u) % size);
+}
+
+inline void performValueIndexRun(std::size_t size)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    LinkedList<std::uint32_t> plain;
+    aisdi::LinkedList<std::uint32_t, aisdi::InlinePayload, aisdi::HashValueIndex<>> indexed;
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        plain.append(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    const double plainAppend = nanosecondsPer(end - start, size);
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        indexed.append(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << size << " elements: append " << plainAppend << " ns plain, " << nanosecondsPer(end - start, size)
+              << " ns indexed; index takes " << indexed.getValueIndexMemoryUsage() << " B ("
+              << static_cast<double>(indexed.getValueIndexMemoryUsage()) / size << " B per element)\n";
+
+    // a linear search walks half the list on average, a handful of them is enough
+    const std::size_t linearLookups = size <= 100000 ? std::min<std::size_t>(size, 100) : 0;
+    std::size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < linearLookups; ++i)
+    {
+        const std::uint32_t key = scrambledKey(i, size);
+        auto it = plain.begin();
+        while(it != plain.end() && *it != key)
+        {
+            ++it;
+        }
+        found += it != plain.end();
+    }
+    end = std::chrono::steady_clock::now();
+    if(linearLookups)
+    {
+        std::cout << "  linear find: " << nanosecondsPer(end - start, linearLookups) << " ns, ";
+    }
+    else
+    {
+        std::cout << "  linear find: skipped, ";
+    }
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        found += indexed.contains(scrambledKey(i, size));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "indexed contains: " << nanosecondsPer(end - start, size) << " ns, ";
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        found += indexed.eraseValue(scrambledKey(i, size));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "indexed eraseValue: " << nanosecondsPer(end - start, size) << " ns (found " << found << ")\n";
+}
+
+inline void performValueIndexTest(std::size_t n)
+{
+    std::cout << "LinkedList with a hash value index, per operation:\n";
+    for(std::size_t size = 1000; size <= n; size *= 10)
+    {
+        performValueIndexRun(size);
+    }
+}
+
+// removing remembered items: re-searching the list for them vs keeping handles
+inline void performHandleTest(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    std::cout << "LinkedList of " << n << " elements, erasing and moving to front remembered items:\n";
+
+    LinkedList<std::uint32_t> plain;
+    LinkedList<std::uint32_t> handled;
+    handled.enableHandles();
+    std::vector<LinkedList<std::uint32_t>::Handle> handles(n);
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        plain.append(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "append: " << nanosecondsPer(end - start, n) << " ns plain, ";
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        handles[i] = handled.append(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << nanosecondsPer(end - start, n) << " ns with handles\n";
+
+    const std::size_t searches = std::min<std::size_t>(n, 100);
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < searches; ++i)
+    {
+        const std::uint32_t key = scrambledKey(i, n);
+        auto it = plain.begin();
+        while(*it != key)
+        {
+            ++it;
+        }
+        plain.erase(it);
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "erase after a linear search: " << nanosecondsPer(end - start, searches) << " ns, ";
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        handled.moveToFront(handles[scrambledKey(i, n)]);
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "moveToFront(handle): " << nanosecondsPer(end - start, n) << " ns, ";
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        handled.erase(handles[scrambledKey(i, n)]);
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "erase(handle): " << nanosecondsPer(end - start, n) << " ns, stale check: "
+              << (handled.isValid(handles[0]) ? "failed" : "ok") << "\n";
+}
+
+template <typename Collection>
+std::uint64_t sumOfValues(const Collection& collection)
+{
+    std::uint64_t sum = 0;
+    for(auto it = collection.begin(); it != collection.end(); ++it)
+    {
+        sum += *it;
+    }
+    return sum;
+}
+
+// entity store workload: fill, iterate, then erase a random live item and insert a new one, churn times
+inline void performSlotMapTest(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    const std::size_t churn = n;
+    std::cout << "Entity store of " << n << " elements, iteration and " << churn << " erase+insert steps:\n";
+
+    aisdi::SlotMap<std::uint32_t> slotMap;
+    std::vector<aisdi::SlotMap<std::uint32_t>::Handle> slotHandles(n);
+    LinkedList<std::uint32_t> list;
+    list.enableHandles();
+    std::vector<LinkedList<std::uint32_t>::Handle> listHandles(n);
+    Vector<std::uint32_t> vector;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        slotHandles[i] = slotMap.insert(static_cast<std::uint32_t>(i));
+        listHandles[i] = list.append(static_cast<std::uint32_t>(i));
+        vector.append(static_cast<std::uint32_t>(i));
+    }
+
+    start = std::chrono::steady_clock::now();
+    std::uint64_t checksum = sumOfValues(slotMap);
+    end = std::chrono::steady_clock::now();
+    std::cout << "iteration: SlotMap " << nanosecondsPer(end - start, n) << " ns, ";
+    start = std::chrono::steady_clock::now();
+    checksum += sumOfValues(list);
+    end = std::chrono::steady_clock::now();
+    std::cout << "LinkedList " << nanosecondsPer(end - start, n) << " ns, ";
+    start = std::chrono::steady_clock::now();
+    checksum += sumOfValues(vector);
+    end = std::chrono::steady_clock::now();
+    std::cout << "Vector " << nanosecondsPer(end - start, n) << " ns per item\n";
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < churn; ++i)
+    {
+        const std::size_t victim = scrambledKey(i, n);
+        slotMap.erase(slotHandles[victim]);
+        slotHandles[victim] = slotMap.insert(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "churn: SlotMap " << nanosecondsPer(end - start, churn) << " ns, ";
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < churn; ++i)
+    {
+        const std::size_t victim = scrambledKey(i, n);
+        list.erase(listHandles[victim]);
+        listHandles[victim] = list.append(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "LinkedList with handles " << nanosecondsPer(end - start, churn) << " ns, ";
+
+    // Vector has no stable positions: erasing shifts the tail, a handful of steps shows the cost
+    const std::size_t vectorChurn = std::min<std::size_t>(churn, 1000);
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < vectorChurn; ++i)
+    {
+        vector.erase(vector.begin() + scrambledKey(i, n));
+        vector.append(static_cast<std::uint32_t>(i));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "Vector " << nanosecondsPer(end - start, vectorChurn) << " ns per step\n";
+
+    start = std::chrono::steady_clock::now();
+    checksum += sumOfValues(slotMap);
+    end = std::chrono::steady_clock::now();
+    std::cout << "iteration after churn: SlotMap " << nanosecondsPer(end - start, n) << " ns, ";
+    start = std::chrono::steady_clock::now();
+    checksum += sumOfValues(list);
+    end = std::chrono::steady_clock::now();
+    std::cout << "LinkedList " << nanosecondsPer(end - start, n) << " ns per item (checksum " << checksum << ")\n";
+}
+
+// n pushes of scrambled keys, n / 4 decreaseKey calls, n pops; then n keys heapified at once and popped
+template <std::size_t Arity>
+void performHeapWorkload(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    aisdi::PriorityQueue<std::uint32_t, std::less<std::uint32_t>, Arity> queue;
+    std::vector<typename aisdi::PriorityQueue<std::uint32_t, std::less<std::uint32_t>, Arity>::Handle> handles(n);
+    std::uint64_t checksum = 0;
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        handles[i] = queue.push(scrambledKey(i, n) + static_cast<std::uint32_t>(n));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << Arity << "-ary: push " << nanosecondsPer(end - start, n) << " ns, ";
+
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n / 4; ++i)
+    {
+        auto& handle = handles[scrambledKey(i, n)];
+        queue.decreaseKey(handle, queue.get(handle) - static_cast<std::uint32_t>(n));
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "decreaseKey " << nanosecondsPer(end - start, n / 4) << " ns, ";
+
+    start = std::chrono::steady_clock::now();
+    while(!queue.isEmpty())
+    {
+        checksum += queue.pop();
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "pop " << nanosecondsPer(end - start, n) << " ns, ";
+
+    std::vector<std::uint32_t> keys(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        keys[i] = scrambledKey(i, n);
+    }
+    start = std::chrono::steady_clock::now();
+    queue.heapify(keys.begin(), keys.end());
+    end = std::chrono::steady_clock::now();
+    std::cout << "heapify " << nanosecondsPer(end - start, n) << " ns per item (checksum " << checksum << ")\n";
+}
+
+// the current scheduler approach: a sorted LinkedList with linear insertion
+inline void performSortedListQueue(std::size_t n)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start, end;
+    LinkedList<std::uint32_t> queue;
+    std::uint64_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        const std::uint32_t key = scrambledKey(i, n);
+        auto it = queue.begin();
+        while(it != queue.end() && *it < key)
+        {
+            ++it;
+        }
+        queue.insert(it, key);
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "sorted LinkedList of " << n << ": insert " << nanosecondsPer(end - start, n) << " ns, ";
+    start = std::chrono::steady_clock::now();
+    while(!queue.isEmpty())
+    {
+        checksum += queue.popFirst();
+    }
+    end = std::chrono::steady_clock::now();
+    std::cout << "popFirst " << nanosecondsPer(end - start, n) << " ns (checksum " << checksum << ")\n";
+}
+
+inline void performPriorityQueueTest(std::size_t n)
+{
+    std::cout << "Priority queue of " << n << " elements, per operation:\n";
+    performHeapWorkload<2>(n);
+    performHeapWorkload<4>(n);
+    performHeapWorkload<8>(n);
+    performSortedListQueue(std::min<std::size_t>(n, 10000));
+}
+
+struct Scenario
+{
+    const char * name;
+    void (*run)(std::size_t n);
+};
+
+inline const std::vector<Scenario>& getScenarios()
+{
+    static const std::vector<Scenario> scenarios = {
+        { "positionalAccess", performPositionalAccessTest },
+        { "compactList", performCompactListTest },
+        { "defragment", performDefragmentTest },
+        { "payload", performPayloadTest },
+        { "queue", performQueueTest },
+        { "lruCache", performLruCacheTest },
+        { "valueIndex", performValueIndexTest },
+        { "handles", performHandleTest },
+        { "slotMap", performSlotMapTest },
+        { "priorityQueue", performPriorityQueueTest }
+    };
+    return scenarios;
+}
+
+inline bool isScenario(const std::string& name)
+{
+    for(const Scenario& scenario : getScenarios())
+    {
+        if(name == scenario.name)
+            return true;
+    }
+    return false;
+}
+
+// Runs the named scenarios ("all" for every one) at each size, in the order of getScenarios().
+// Throws std::invalid_argument for an unknown name before running any.
+inline void runScenarios(const std::vector<std::string>& names, const std::vector<std::size_t>& sizes)
+{
+    const bool all = std::find(names.begin(), names.end(), "all") != names.end();
+    for(const std::string& name : names)
+    {
+        if(name != "all" && !isScenario(name))
+            throw std::invalid_argument("Unknown scenario: " + name);
+    }
+    for(std::size_t size : sizes)
+    {
+        for(const Scenario& scenario : getScenarios())
+        {
+            if(!all && std::find(names.begin(), names.end(), scenario.name) == names.end())
+                continue;
+            std::cout << "---------------------------------------- " << scenario.name << "\n";
+            scenario.run(size);
+        }
+    }
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_SCENARIOS_H
@@ -0,0 +1,132 @@
+#ifndef AISDI_LINEAR_BENCH_STDADAPTERS_H
+#define AISDI_LINEAR_BENCH_STDADAPTERS_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// The interface of Vector and LinkedList the operations use, over std::vector, std::deque or
+// std::list, so that the standard containers run the very same benchmarks as baselines.
+template <typename StdContainer>
+class StdAdapter
+{
+public:
+    using size_type = std::size_t;
+    using value_type = typename StdContainer::value_type;
+    using iterator = typename StdContainer::iterator;
+    using const_iterator = typename StdContainer::const_iterator;
+
+    bool isEmpty() const
+    {
+        return items.empty();
+    }
+
+    size_type getSize() const
+    {
+        return items.size();
+    }
+
+    void append(const value_type& item)
+    {
+        items.push_back(item);
+    }
+
+    void append(value_type&& item)
+    {
+        items.push_back(std::move(item));
+    }
+
+    // insert() at the beginning: push_front for std::deque and std::list, a shift for std::vector
+    void prepend(const value_type& item)
+    {
+        items.insert(items.begin(), item);
+    }
+
+    void prepend(value_type&& item)
+    {
+        items.insert(items.begin(), std::move(item));
+    }
+
+    void insert(const const_iterator& insertPosition, const value_type& item)
+    {
+        items.insert(insertPosition, item);
+    }
+
+    void insert(const const_iterator& insertPosition, value_type&& item)
+    {
+        items.insert(insertPosition, std::move(item));
+    }
+
+    value_type popFirst()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+        value_type returned = std::move(items.front());
+        items.erase(items.begin());
+        return returned;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+        value_type returned = std::move(items.back());
+        items.pop_back();
+        return returned;
+    }
+
+    void erase(const const_iterator& position)
+    {
+        items.erase(position);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        items.erase(firstIncluded, lastExcluded);
+    }
+
+    const_iterator cbegin() const
+    {
+        return items.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return items.cend();
+    }
+
+    // the adapted container, e.g. for capacity() of std::vector
+    const StdContainer& getItems() const
+    {
+        return items;
+    }
+
+private:
+    StdContainer items;
+};
+
+// cbegin() + index: the operations reach positions through it, std::list iterators have no operator+.
+template <typename Container>
+typename Container::const_iterator iteratorAt(const Container& container, std::size_t index)
+{
+    return container.cbegin() + index;
+}
+
+template <typename StdContainer>
+typename StdContainer::const_iterator iteratorAt(const StdAdapter<StdContainer>& container, std::size_t index)
+{
+    return std::next(container.cbegin(), index);
+}
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_STDADAPTERS_H
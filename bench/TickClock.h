@@ -0,0 +1,80 @@
+#ifndef AISDI_LINEAR_BENCH_TICKCLOCK_H
+#define AISDI_LINEAR_BENCH_TICKCLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace aisdi
+{
+
+namespace bench
+{
+
+// Cheap timestamps for timing single operations: the time stamp counter on x86 (a few ns to
+// read, against some 20 ns for clock_gettime), steady_clock elsewhere. The counter is assumed to be
+// invariant (constant rate, synchronized across cores), as on every x86 of the last decade;
+// its rate is calibrated once against steady_clock.
+class TickClock
+{
+    using Clock = std::chrono::steady_clock;
+
+public:
+    static std::uint64_t now()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    static double nanosecondsPerTick()
+    {
+        static const double calibrated = calibrate();
+        return calibrated;
+    }
+
+    static double toNanoseconds(std::uint64_t ticks)
+    {
+        return ticks * nanosecondsPerTick();
+    }
+
+    // of an empty now() - now() pair, in nanoseconds: the floor of every single operation timing
+    static double overhead()
+    {
+        std::uint64_t least = ~std::uint64_t(0);
+        for(int i = 0; i < 1000; ++i)
+        {
+            std::uint64_t start = now();
+            std::uint64_t end = now();
+            if(end - start < least)
+                least = end - start;
+        }
+        return toNanoseconds(least);
+    }
+
+private:
+    static double calibrate()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        const Clock::time_point clockStart = Clock::now();
+        const std::uint64_t ticksStart = now();
+        Clock::time_point clockEnd;
+        do
+        {
+            clockEnd = Clock::now();
+        }
+        while(clockEnd - clockStart < std::chrono::milliseconds(20));
+        const std::uint64_t ticksEnd = now();
+        return std::chrono::duration<double, std::nano>(clockEnd - clockStart).count() / (ticksEnd - ticksStart);
+#else
+        return 1;
+#endif
+    }
+};
+
+} // namespace bench
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_BENCH_TICKCLOCK_H
@@ -0,0 +1,540 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "HotPathTrace.h"
+#include "Vector.h"
+#include "LinkedList.h"
+
+#include "Compare.h"
+#include "Footprint.h"
+#include "Harness.h"
+#include "Operations.h"
+#include "PerfCounters.h"
+#include "Replay.h"
+#include "Report.h"
+#include "Scenarios.h"
+#include "StdAdapters.h"
+
+namespace
+{
+
+using namespace aisdi::bench;
+
+const char * const usage =
+    "usage: aisdiLinearBench [option...]\n"
+    "  --operation=NAME[,NAME...]  only these operations (see --list)\n"
+    "  --container=NAME[,NAME...]  only these containers\n"
+    "  --type=NAME[,NAME...]       only these element types: int32, uint64, string (short),\n"
+    "                              heapString, pod64, pod1k, moveOnly, counted\n"
+    "  --size=N[,N...]             only these sizes instead of the sweep\n"
+    "  --min-size=N --max-size=N --size-factor=N\n"
+    "                              geometric size sweep (default 1000..100000, x10)\n"
+    "  --repetitions=N             measured samples per case and size (default 7)\n"
+    "  --warmup=N                  discarded samples before them (default 1)\n"
+    "  --latency                   time every step (or batch) on its own and report percentiles\n"
+    "  --batch=N                   steps per timing in latency mode (default 1)\n"
+    "  --dump-histogram            print the full latency histograms too (implies --latency)\n"
+    "  --counters                  hardware counters per step (perf_event_open), where available\n"
+    "  --allocations               heap allocations and requested bytes per step\n"
+    "  --element-operations        copies, moves, copy and move assignments of elements per\n"
+    "                              step, counted for the counted type\n"
+    "  --replay=FILE[,FILE...]     replay recorded traces (binary or text) on every container\n"
+    "                              instead of the operations\n"
+    "  --footprint                 memory per element of filled containers instead of times\n"
+    "  --scenario=NAME[,NAME...]   run these stand-alone workloads instead of the operations, at\n"
+    "                              --size (default 10000): positionalAccess, compactList,\n"
+    "                              defragment, payload, queue, lruCache, valueIndex, handles,\n"
+    "                              slotMap, priorityQueue, or all\n"
+    "  --hot-path-trace=FILE       write the reallocations, range erases, bulk copies and long\n"
+    "                              traversals of the containers as Chrome Trace JSON (needs a\n"
+    "                              build with -DAISDI_LINEAR_HOT_PATH_TRACE=ON)\n"
+    "  --format=text|json|csv      of the results (default text)\n"
+    "  --output=FILE               write the results there instead of the standard output\n"
+    "  --baseline=FILE             compare the results to the ones in FILE (JSON or CSV), exit\n"
+    "                              with a failure on a regression\n"
+    "  --compare=BASELINE,CURRENT  compare two result files instead of measuring\n"
+    "  --threshold=PERCENT         median growth counted as a regression (default 10)\n"
+    "  --alpha=P                   significance level of a regression (default 0.05)\n"
+    "  --list                      print the cases and exit\n"
+    "  --help                      print this text and exit\n";
+
+std::vector<std::string> splitList(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::istringstream stream(list);
+    std::string item;
+    while(std::getline(stream, item, ','))
+    {
+        if(!item.empty())
+            items.push_back(item);
+    }
+    return items;
+}
+
+double parseNumber(const std::string& text)
+{
+    std::size_t parsedLength = 0;
+    double number = std::stod(text, &parsedLength);
+    if(parsedLength != text.size())
+        throw std::invalid_argument("Not a number: " + text);
+    return number;
+}
+
+std::size_t parseCount(const std::string& text)
+{
+    std::size_t parsedLength = 0;
+    unsigned long long count = std::stoull(text, &parsedLength);
+    if(parsedLength != text.size())
+        throw std::invalid_argument("Not a number: " + text);
+    return static_cast<std::size_t>(count);
+}
+
+Options parseOptions(int argc, char** argv)
+{
+    Options options;
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const std::size_t equals = argument.find('=');
+        const std::string name = argument.substr(0, equals);
+        const std::string value = equals == std::string::npos ? "" : argument.substr(equals + 1);
+
+        if(name == "--operation")
+            options.operations = splitList(value);
+        else if(name == "--container")
+            options.containers = splitList(value);
+        else if(name == "--type")
+            options.types = splitList(value);
+        else if(name == "--size")
+        {
+            options.sizes.clear();
+            for(const std::string& size : splitList(value))
+                options.sizes.push_back(parseCount(size));
+        }
+        else if(name == "--min-size")
+            options.minSize = parseCount(value);
+        else if(name == "--max-size")
+            options.maxSize = parseCount(value);
+        else if(name == "--size-factor")
+            options.sizeFactor = parseCount(value);
+        else if(name == "--repetitions")
+            options.repetitions = parseCount(value);
+        else if(name == "--warmup")
+            options.warmup = parseCount(value);
+        else if(name == "--latency")
+            options.latency = true;
+        else if(name == "--batch")
+            options.batch = parseCount(value);
+        else if(name == "--dump-histogram")
+            options.latency = options.dumpHistograms = true;
+        else if(name == "--counters")
+            options.counters = true;
+        else if(name == "--allocations")
+            options.allocations = true;
+        else if(name == "--element-operations")
+            options.elementOperations = true;
+        else if(name == "--replay")
+            options.replay = splitList(value);
+        else if(name == "--hot-path-trace")
+            options.hotPathTrace = value;
+        else if(name == "--footprint")
+            options.footprint = true;
+        else if(name == "--scenario")
+            options.scenarios = splitList(value);
+        else if(name == "--format")
+        {
+            parseFormat(value);
+            options.format = value;
+        }
+        else if(name == "--output")
+            options.output = value;
+        else if(name == "--baseline")
+            options.baseline = value;
+        else if(name == "--compare")
+            options.compare = splitList(value);
+        else if(name == "--threshold")
+            options.threshold = parseNumber(value);
+        else if(name == "--alpha")
+            options.alpha = parseNumber(value);
+        else if(name == "--list")
+            options.list = true;
+        else if(name == "--help")
+        {
+            std::cout << usage;
+            std::exit(EXIT_SUCCESS);
+        }
+        else
+            throw std::invalid_argument("Unknown option: " + argument);
+    }
+    if(options.repetitions == 0)
+        throw std::invalid_argument("At least one repetition is needed");
+    if(options.batch == 0)
+        throw std::invalid_argument("A batch needs at least one step");
+    if(!options.compare.empty() && options.compare.size() != 2)
+        throw std::invalid_argument("--compare needs two files");
+    if(options.footprint && options.format != "text")
+        throw std::invalid_argument("--footprint reports text only");
+    return options;
+}
+
+// Every container holding Type.
+template <typename Type>
+void addContainers(Registry& registry)
+{
+    addOperations<aisdi::Vector<Type>>(registry, "Vector");
+    addOperations<aisdi::LinkedList<Type>>(registry, "LinkedList");
+    addOperations<StdAdapter<std::vector<Type>>>(registry, "std::vector");
+    addOperations<StdAdapter<std::deque<Type>>>(registry, "std::deque");
+    addOperations<StdAdapter<std::list<Type>>>(registry, "std::list");
+}
+
+// The element type matrix: scalars, records of 64 B and 1 KiB copied by memcpy, a short
+// string, a string owning a heap buffer, a move-only type and one counting its copies and moves.
+Registry makeRegistry()
+{
+    Registry registry;
+    addContainers<std::int32_t>(registry);
+    addContainers<std::uint64_t>(registry);
+    addContainers<std::string>(registry);
+    addContainers<HeapString>(registry);
+    addContainers<Pod64>(registry);
+    addContainers<Pod1K>(registry);
+    addContainers<std::unique_ptr<std::uint64_t>>(registry);
+    addContainers<OperationCountingObject>(registry);
+    return registry;
+}
+
+template <typename Type>
+void addReplays(Registry& registry, const std::string& name, const aisdi::Trace& trace)
+{
+    addReplay<aisdi::Vector<Type>>(registry, "Vector", name, trace);
+    addReplay<aisdi::LinkedList<Type>>(registry, "LinkedList", name, trace);
+    addReplay<StdAdapter<std::vector<Type>>>(registry, "std::vector", name, trace);
+    addReplay<StdAdapter<std::deque<Type>>>(registry, "std::deque", name, trace);
+    addReplay<StdAdapter<std::list<Type>>>(registry, "std::list", name, trace);
+}
+
+// The cases replaying one trace on every container and element type.
+Registry makeReplayRegistry(const std::string& name, const aisdi::Trace& trace)
+{
+    Registry registry;
+    addReplays<std::int32_t>(registry, name, trace);
+    addReplays<std::uint64_t>(registry, name, trace);
+    addReplays<std::string>(registry, name, trace);
+    addReplays<HeapString>(registry, name, trace);
+    addReplays<Pod64>(registry, name, trace);
+    addReplays<Pod1K>(registry, name, trace);
+    addReplays<std::unique_ptr<std::uint64_t>>(registry, name, trace);
+    addReplays<OperationCountingObject>(registry, name, trace);
+    return registry;
+}
+
+template <typename Type>
+void addFootprints(FootprintRegistry& registry)
+{
+    registry.add<aisdi::Vector<Type>>("Vector");
+    registry.add<aisdi::LinkedList<Type>>("LinkedList");
+    registry.add<StdAdapter<std::vector<Type>>>("std::vector");
+    registry.add<StdAdapter<std::deque<Type>>>("std::deque");
+    registry.add<StdAdapter<std::list<Type>>>("std::list");
+}
+
+// the types of different sizes, the others are as large as one of them
+FootprintRegistry makeFootprintRegistry()
+{
+    FootprintRegistry registry;
+    addFootprints<std::int32_t>(registry);
+    addFootprints<std::uint64_t>(registry);
+    addFootprints<std::string>(registry);
+    addFootprints<HeapString>(registry);
+    addFootprints<Pod64>(registry);
+    addFootprints<Pod1K>(registry);
+    return registry;
+}
+
+// Measures the selected cases grouped by operation and type, so that every size is measured
+// on all containers one after another and compared to the baselines among them.
+std::vector<Result> runSelected(const Registry& registry, const Options& options, const std::vector<std::size_t>& sizes,
+                                PerfCounters * counters, Report& report)
+{
+    std::vector<Result> measured;
+    std::vector<std::pair<std::string, std::string>> groups;
+    for(const Case& benchmarkCase : registry.getCases())
+    {
+        std::pair<std::string, std::string> group(benchmarkCase.operation, benchmarkCase.type);
+        if(selected(options, benchmarkCase) && std::find(groups.begin(), groups.end(), group) == groups.end())
+            groups.push_back(group);
+    }
+
+    for(const std::pair<std::string, std::string>& group : groups)
+    {
+        for(std::size_t size : sizes)
+        {
+            std::vector<Result> results;
+            for(const Case& benchmarkCase : registry.getCases())
+            {
+                if(selected(options, benchmarkCase) && benchmarkCase.operation == group.first
+                   && benchmarkCase.type == group.second)
+                    results.push_back(benchmarkCase.measure(size, options, counters));
+            }
+            compareToBaselines(results);
+            for(const Result& result : results)
+            {
+                report.add(result);
+                measured.push_back(result);
+            }
+        }
+    }
+    return measured;
+}
+
+// Exits with a failure on regressions, so that it can be a test.
+int compareAndExit(std::ostream& out, const std::vector<Record>& baseline, const std::vector<Record>& current,
+                   const Options& options)
+{
+    const std::vector<Comparison> comparisons = compareRecords(baseline, current, options.threshold, options.alpha);
+    const std::size_t unmatched = baseline.size() + current.size() - 2 * comparisons.size();
+    const std::size_t regressions = printComparisons(out, comparisons, unmatched, options.threshold, options.alpha);
+    return regressions > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// The events of the whole run; the rings keep the latest ones of every thread.
+void writeHotPathTrace(std::ostream& out)
+{
+#ifndef AISDI_LINEAR_HOT_PATH_TRACE
+    std::cerr << "# built without AISDI_LINEAR_HOT_PATH_TRACE, the hot path trace is empty\n";
+#endif
+    const std::uint64_t dropped = aisdi::HotPathTracer::instance().getDropped();
+    if(dropped > 0)
+        std::cerr << "# " << dropped << " earliest hot path events were overwritten\n";
+    aisdi::exportChromeTrace(out);
+}
+
+void printFootprintHeader()
+{
+    if(!tracksLiveBytes())
+        std::cout << "# the allocator does not tell block sizes, heap bytes are unknown (0)\n";
+    std::cout << "# bytes per element; heap: usable block sizes and " << heapHeaderBytes()
+              << " B allocator header per block, total: heap and the container object\n";
+    std::cout << std::left << std::setw(13) << "container" << std::setw(11) << "type" << std::right
+              << std::setw(10) << "size" << std::setw(9) << "payload" << std::setw(11) << "requested"
+              << std::setw(9) << "heap" << std::setw(9) << "total" << std::setw(12) << "overhead %"
+              << std::setw(10) << "blocks" << std::setw(9) << "peak" << std::setw(9) << "RSS"
+              << std::setw(9) << "slack %" << std::setw(14) << "peak RSS KiB" << "\n";
+}
+
+void printFootprint(const Footprint& footprint)
+{
+    std::cout << std::left << std::setw(13) << footprint.container << std::setw(11) << footprint.type
+              << std::right << std::setw(10) << footprint.size << std::fixed << std::setprecision(2)
+              << std::setw(9) << footprint.perElement(footprint.payloadBytes);
+    if(footprint.hasStats)
+        std::cout << std::setw(11) << footprint.perElement(footprint.requestedBytes);
+    else
+        std::cout << std::setw(11) << "-";
+    std::cout << std::setw(9) << footprint.perElement(footprint.heapBytes)
+              << std::setw(9) << footprint.perElement(footprint.getTotalBytes())
+              << std::setprecision(1) << std::setw(12) << footprint.overhead() << std::setw(10) << footprint.blocks
+              << std::setprecision(2) << std::setw(9) << footprint.perElement(footprint.peakHeapBytes)
+              << std::setw(9) << footprint.perElement(footprint.residentBytes);
+    if(footprint.hasCapacity)
+        std::cout << std::setprecision(1) << std::setw(9) << footprint.slack();
+    else
+        std::cout << std::setw(9) << "-";
+    std::cout << std::setw(14) << peakResidentBytes() / 1024 << std::endl;
+}
+
+// How the capacity slack of Vector at the measured sizes would change with its growth factor.
+void printGrowthModels(const Options& options)
+{
+    const double factors[] = { 1.25, 1.5, 2, 3 };
+    std::cout << "# Vector growth factor model (8 elements, then times the factor; Vector grows x2)\n"
+              << std::left << std::setw(10) << "factor" << std::right << std::setw(10) << "size"
+              << std::setw(10) << "capacity" << std::setw(9) << "slack %" << std::setw(13) << "mean slack %"
+              << std::setw(9) << "reallocs" << std::setw(12) << "copies/el" << "\n";
+    for(std::size_t size : options.sweep())
+    {
+        for(double factor : factors)
+        {
+            const GrowthModel model = modelGrowth(size, factor);
+            std::cout << std::left << std::fixed << std::setprecision(2) << std::setw(10) << model.factor
+                      << std::right << std::setw(10) << size << std::setw(10) << model.capacity
+                      << std::setprecision(1) << std::setw(9) << model.slack << std::setw(13) << model.meanSlack
+                      << std::setw(9) << model.reallocations << std::setprecision(2)
+                      << std::setw(12) << model.copiesPerElement << "\n";
+        }
+    }
+}
+
+// Measures every selected container from the smallest size up, so that the peak resident set
+// printed next to each row is the largest container so far.
+void runFootprints(const FootprintRegistry& registry, const Options& options)
+{
+    printFootprintHeader();
+    for(std::size_t size : options.sweep())
+    {
+        for(const FootprintCase& footprintCase : registry.getCases())
+        {
+            if(selected(options.containers, footprintCase.container) && selected(options.types, footprintCase.type))
+                printFootprint(footprintCase.measure(size));
+        }
+    }
+    if(selected(options.containers, "Vector"))
+        printGrowthModels(options);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << "\n" << usage;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        if(!options.compare.empty())
+            return compareAndExit(std::cout, readRecords(options.compare[0]), readRecords(options.compare[1]), options);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    if(options.footprint)
+    {
+        runFootprints(makeFootprintRegistry(), options);
+        return EXIT_SUCCESS;
+    }
+
+    if(!options.scenarios.empty())
+    {
+        try
+        {
+            runScenarios(options.scenarios, options.sizes.empty() ? std::vector<std::size_t>(1, 10000) : options.sizes);
+        }
+        catch(const std::exception& e)
+        {
+            std::cerr << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // the operations on the swept sizes, or every trace replayed (its size is the largest it reaches)
+    std::deque<aisdi::Trace> traces; // the replay cases point to them
+    std::vector<Registry> registries;
+    std::vector<std::vector<std::size_t>> sizes;
+    try
+    {
+        for(const std::string& path : options.replay)
+        {
+            traces.push_back(loadTrace(path));
+            const TraceShape shape = TraceShape::of(traces.back());
+            registries.push_back(makeReplayRegistry(traceName(path), traces.back()));
+            sizes.push_back(std::vector<std::size_t>(1, static_cast<std::size_t>(shape.peakSize)));
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    if(options.replay.empty())
+    {
+        registries.push_back(makeRegistry());
+        sizes.push_back(options.sweep());
+    }
+
+    if(options.list)
+    {
+        for(const Registry& registry : registries)
+        {
+            for(const Case& benchmarkCase : registry.getCases())
+            {
+                std::cout << benchmarkCase.operation << " " << benchmarkCase.container
+                          << " " << benchmarkCase.type << "\n";
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+
+    PerfCounters counters;
+    PerfCounters * usedCounters = nullptr;
+    if(options.counters)
+    {
+        if(counters.isAvailable())
+            usedCounters = &counters;
+        else
+            std::cerr << "# hardware counters unavailable (" << counters.getFailure() << "), reporting time only\n";
+    }
+
+    std::vector<Record> baseline;
+    std::ofstream file;
+    std::ofstream hotPathFile;
+    try
+    {
+        if(!options.baseline.empty())
+            baseline = readRecords(options.baseline);
+        if(!options.output.empty())
+        {
+            file.open(options.output);
+            if(!file)
+                throw std::runtime_error("Cannot write " + options.output);
+        }
+        if(!options.hotPathTrace.empty())
+        {
+            hotPathFile.open(options.hotPathTrace);
+            if(!hotPathFile)
+                throw std::runtime_error("Cannot write " + options.hotPathTrace);
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    std::ostream& out = options.output.empty() ? std::cout : file;
+
+    Report report(out, parseFormat(options.format), options, usedCounters);
+    report.begin();
+    std::vector<Result> results;
+    for(std::size_t i = 0; i < registries.size(); ++i)
+    {
+        const std::vector<Result> measured = runSelected(registries[i], options, sizes[i], usedCounters, report);
+        results.insert(results.end(), measured.begin(), measured.end());
+    }
+    report.end();
+    if(hotPathFile.is_open())
+        writeHotPathTrace(hotPathFile);
+    if(options.baseline.empty())
+        return EXIT_SUCCESS;
+
+    std::vector<Record> current;
+    for(const Result& result : results)
+        current.push_back(toRecord(result));
+    // the records keep the standard output to themselves
+    const bool recordsOnStandardOutput = options.output.empty() && options.format != "text";
+    return compareAndExit(recordsOnStandardOutput ? std::cerr : std::cout, baseline, current, options);
+}
@@ -0,0 +1,56 @@
+#ifndef AISDI_LINEAR_ALLOCATIONSTATS_H
+#define AISDI_LINEAR_ALLOCATIONSTATS_H
+
+#include <cstddef>
+
+namespace aisdi
+{
+
+// Heap traffic of one container, see Vector::enableAllocationStats() and
+// LinkedList::enableAllocationStats(). Bytes are the ones requested, without allocator headers.
+struct AllocationStats
+{
+    using size_type = std::size_t;
+
+    size_type allocations;
+    size_type frees;
+    size_type bytesAllocated;
+    size_type liveBytes;
+    size_type peakLiveBytes;
+    size_type reallocations; // blocks replaced by larger or relocated ones
+
+    AllocationStats() : allocations(0), frees(0), bytesAllocated(0), liveBytes(0), peakLiveBytes(0), reallocations(0)
+    {
+
+    }
+
+    void allocated(size_type bytes)
+    {
+        ++allocations;
+        bytesAllocated += bytes;
+        adopted(bytes);
+    }
+
+    void freed(size_type bytes)
+    {
+        ++frees;
+        released(bytes);
+    }
+
+    // memory taken over from another container without an allocation, e.g. spliced nodes
+    void adopted(size_type bytes)
+    {
+        liveBytes += bytes;
+        if(liveBytes > peakLiveBytes)
+            peakLiveBytes = liveBytes;
+    }
+
+    void released(size_type bytes)
+    {
+        liveBytes = liveBytes > bytes ? liveBytes - bytes : 0;
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_ALLOCATIONSTATS_H
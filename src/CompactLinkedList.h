@@ -0,0 +1,601 @@
+#ifndef AISDI_LINEAR_COMPACTLINKEDLIST_H
+#define AISDI_LINEAR_COMPACTLINKEDLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Doubly linked list whose nodes live in one growable array and link to each other with 32-bit indices.
+// Erased slots are reused through a free list, so nodes cost 8 bytes of links and no allocator header.
+// Slot 0 is the sentinel. Iterators hold the list and a slot index: they survive growth of the array,
+// but compact() renumbers the nodes and invalidates them.
+template <typename Type>
+class CompactLinkedList
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+private:
+    using index_type = std::uint32_t;
+    static const index_type nil = 0xFFFFFFFFu; // plays the role of nullptr in links
+    static const index_type sentinel = 0;
+
+    struct Slot
+    {
+        index_type next; // for free slots: next free slot
+        index_type prev;
+        typename std::aligned_storage<sizeof(Type), alignof(Type)>::type storage;
+    };
+
+    Slot * slots;
+    size_type capacity;
+    size_type used; // slots [0, used) have been handed out at least once, the rest were never touched
+    index_type first; // head, the sentinel when empty
+    index_type freeHead;
+    size_type count;
+
+    Type& itemOf(index_type index)
+    {
+        return *reinterpret_cast<Type *>(&slots[index].storage);
+    }
+
+    const Type& itemOf(index_type index) const
+    {
+        return *reinterpret_cast<const Type *>(&slots[index].storage);
+    }
+
+    size_type newCapacity() const
+    {
+        size_type result = capacity == 0 ? 8 : capacity * 2; // same policy as Vector
+        if(result > nil)
+            result = nil; // nil itself is never a slot index
+        if(result <= capacity)
+            throw std::length_error("CompactLinkedList cannot address more nodes");
+        return result;
+    }
+
+    // moves the items to target, keeping slot indices, or renumbering them into list order (1, 2, ...)
+    void moveItemsTo(Slot * target, bool renumber)
+    {
+        index_type index = first;
+        index_type rank = 1;
+        try
+        {
+            for(; index != sentinel; index = slots[index].next, ++rank)
+                new (&target[renumber ? rank : index].storage) Type(std::move_if_noexcept(itemOf(index)));
+        }
+        catch(...)
+        {
+            rank = 1;
+            for(index_type built = first; built != index; built = slots[built].next, ++rank)
+                reinterpret_cast<Type *>(&target[renumber ? rank : built].storage)->~Type();
+            throw;
+        }
+        for(index = first; index != sentinel; index = slots[index].next)
+            itemOf(index).~Type();
+    }
+
+    // links after compact(): node i sits in slot i
+    void linkInOrder()
+    {
+        index_type last = static_cast<index_type>(count);
+        for(index_type i = 1; i <= last; ++i)
+        {
+            slots[i].prev = i - 1;
+            slots[i].next = i + 1;
+        }
+        slots[sentinel].next = nil;
+        slots[sentinel].prev = count ? last : nil;
+        if(count)
+        {
+            slots[1].prev = nil;
+            slots[last].next = sentinel;
+        }
+        first = count ? 1 : sentinel;
+        used = count + 1;
+        freeHead = nil;
+    }
+
+    // the item is constructed before any existing one is relocated, so it may refer into this list;
+    // Item is const Type& or Type, so that the item is copied or moved in
+    template <typename Item>
+    index_type createNode(Item&& item)
+    {
+        if(freeHead != nil)
+        {
+            index_type index = freeHead;
+            new (&slots[index].storage) Type(std::forward<Item>(item));
+            freeHead = slots[index].next;
+            return index;
+        }
+        if(used < capacity)
+        {
+            new (&slots[used].storage) Type(std::forward<Item>(item));
+            return static_cast<index_type>(used++);
+        }
+
+        size_type grownCapacity = newCapacity();
+        Slot * grown = new Slot [grownCapacity];
+        try
+        {
+            new (&grown[used].storage) Type(std::forward<Item>(item));
+        }
+        catch(...)
+        {
+            delete [] grown;
+            throw;
+        }
+        try
+        {
+            moveItemsTo(grown, false);
+        }
+        catch(...)
+        {
+            reinterpret_cast<Type *>(&grown[used].storage)->~Type();
+            delete [] grown;
+            throw;
+        }
+        for(size_type i = 0; i < used; ++i)
+        {
+            grown[i].next = slots[i].next;
+            grown[i].prev = slots[i].prev;
+        }
+        delete [] slots;
+        slots = grown;
+        capacity = grownCapacity;
+        return static_cast<index_type>(used++);
+    }
+
+    void linkBefore(index_type position, index_type index)
+    {
+        slots[index].next = position;
+        if(position == first)
+        {
+            slots[index].prev = nil;
+            first = index;
+        }
+        else
+        {
+            slots[index].prev = slots[position].prev;
+            slots[slots[position].prev].next = index;
+        }
+        slots[position].prev = index;
+        ++count;
+    }
+
+    void unlink(index_type index)
+    {
+        if(index == first)
+        {
+            first = slots[index].next;
+            slots[first].prev = nil;
+        }
+        else
+        {
+            slots[slots[index].prev].next = slots[index].next;
+            slots[slots[index].next].prev = slots[index].prev;
+        }
+        --count;
+    }
+
+    void destroyNode(index_type index)
+    {
+        itemOf(index).~Type();
+        slots[index].next = freeHead;
+        freeHead = index;
+    }
+
+    void initialize()
+    {
+        slots = nullptr;
+        capacity = 0;
+        capacity = newCapacity();
+        slots = new Slot [capacity];
+        used = 1;
+        first = sentinel;
+        freeHead = nil;
+        count = 0;
+        slots[sentinel].next = nil;
+        slots[sentinel].prev = nil;
+    }
+
+    void release()
+    {
+        for(index_type index = first; index != sentinel; index = slots[index].next)
+            itemOf(index).~Type();
+        delete [] slots;
+    }
+
+    void swap(CompactLinkedList& other)
+    {
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(used, other.used);
+        std::swap(first, other.first);
+        std::swap(freeHead, other.freeHead);
+        std::swap(count, other.count);
+    }
+
+public:
+    CompactLinkedList()
+    {
+        initialize();
+    }
+
+    CompactLinkedList(std::initializer_list<Type> l)
+    {
+        initialize();
+        for(auto p = l.begin(); p != l.end(); ++p)
+            append(*p);
+    }
+
+    CompactLinkedList(const CompactLinkedList& other)
+    {
+        initialize();
+        for(auto i = other.cbegin(); i != other.cend(); ++i)
+            append(*i);
+    }
+
+    CompactLinkedList(CompactLinkedList&& other)
+    {
+        initialize();
+        swap(other);
+    }
+
+    ~CompactLinkedList()
+    {
+        release();
+    }
+
+    CompactLinkedList& operator=(const CompactLinkedList& other)
+    {
+        if(this == &other)
+            return *this;
+
+        erase(begin(), end());
+        for(auto it = other.begin(); it != other.end(); ++it)
+            append(*it);
+
+        return *this;
+    }
+
+    CompactLinkedList& operator=(CompactLinkedList&& other)
+    {
+        if(this == &other)
+            return *this;
+
+        erase(begin(), end());
+        swap(other);
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return count == 0;
+    }
+
+    size_type getSize() const
+    {
+        return count;
+    }
+
+    // number of slots in the array, the sentinel included
+    size_type getCapacity() const
+    {
+        return capacity;
+    }
+
+    void append(const Type& item)
+    {
+        index_type index = createNode(item);
+        linkBefore(sentinel, index);
+    }
+
+    void append(Type&& item)
+    {
+        index_type index = createNode(std::move(item));
+        linkBefore(sentinel, index);
+    }
+
+    void prepend(const Type& item)
+    {
+        index_type index = createNode(item);
+        linkBefore(first, index);
+    }
+
+    void prepend(Type&& item)
+    {
+        index_type index = createNode(std::move(item));
+        linkBefore(first, index);
+    }
+
+    void insert(const const_iterator& insertPosition, const Type& item)
+    {
+        index_type index = createNode(item);
+        linkBefore(insertPosition.current, index);
+    }
+
+    void insert(const const_iterator& insertPosition, Type&& item)
+    {
+        index_type index = createNode(std::move(item));
+        linkBefore(insertPosition.current, index);
+    }
+
+    // The popped item is moved out when that cannot throw (or it cannot be copied), else copied,
+    // so that a throwing copy leaves the list as it was.
+    Type popFirst()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+
+        value_type returned(std::move_if_noexcept(itemOf(first)));
+        erase(begin());
+
+        return returned;
+    }
+
+    Type popLast()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+
+        value_type returned(std::move_if_noexcept(itemOf(slots[sentinel].prev)));
+        erase(--end());
+
+        return returned;
+    }
+
+    void erase(const const_iterator& position)
+    {
+        if(isEmpty() || position == cend())
+            throw std::out_of_range("Attempt to erase an item out of scope or the container is empty");
+
+        unlink(position.current);
+        destroyNode(position.current);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        auto ptr = firstIncluded;
+        while(ptr != lastExcluded)
+        {
+            auto erased = ptr; // temporary for deletion
+            ++ptr;
+            erase(erased);
+        }
+    }
+
+    // Renumbers the nodes into list order, so that traversal walks the array sequentially,
+    // and drops the free list; the capacity is kept. O(n) moves into a new array, invalidates iterators.
+    void compact()
+    {
+        Slot * compacted = new Slot [capacity];
+        try
+        {
+            moveItemsTo(compacted, true);
+        }
+        catch(...)
+        {
+            delete [] compacted;
+            throw;
+        }
+        delete [] slots;
+        slots = compacted;
+        linkInOrder();
+    }
+
+    iterator begin()
+    {
+        return const_iterator(this, first);
+    }
+
+    iterator end()
+    {
+        return const_iterator(this, sentinel);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, first);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, sentinel);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+class CompactLinkedList<Type>::ConstIterator
+{
+    friend CompactLinkedList<Type>;
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename CompactLinkedList::value_type;
+    using difference_type = typename CompactLinkedList::difference_type;
+    using pointer = typename CompactLinkedList::const_pointer;
+    using reference = typename CompactLinkedList::const_reference;
+
+protected:
+    const CompactLinkedList * owner;
+    index_type current;
+
+    ConstIterator(const CompactLinkedList * list, index_type index) : owner(list), current(index)
+    {
+
+    }
+
+    index_type nextOf(index_type index) const
+    {
+        return owner->slots[index].next;
+    }
+
+    index_type prevOf(index_type index) const
+    {
+        return owner->slots[index].prev;
+    }
+
+public:
+    explicit ConstIterator() : owner(nullptr), current(sentinel)
+    {}
+
+    reference operator*() const
+    {
+        if(current == sentinel)
+            throw std::out_of_range("Attempt to dereference the end() iterator");
+        return owner->itemOf(current);
+    }
+
+    ConstIterator& operator++()
+    {
+        if(current == sentinel)
+            throw std::out_of_range("Attempt to increment the end() itertator");
+        current = nextOf(current);
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        auto result = *this;
+        ++(*this);
+        return result;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(prevOf(current) == nil) // head detected
+            throw std::out_of_range("Attempt to decrement the begin() iterator");
+        current = prevOf(current);
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        auto result = *this;
+        --(*this);
+        return result;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        auto it = *this;
+        for(difference_type i = 0; i < d; ++i)
+        {
+            if(it.current == sentinel)
+                throw std::range_error("Attempt to move the iterator beyond end()");
+            it.current = nextOf(it.current);
+        }
+        return it;
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        auto it = *this;
+        for(difference_type i = 0; i < d && prevOf(it.current) != nil; ++i)
+            it.current = prevOf(it.current);
+        return it;
+    }
+
+    // indexes are only unique within one list, end() of every list is the sentinel slot
+    bool operator==(const ConstIterator& other) const
+    {
+        return owner == other.owner && current == other.current;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class CompactLinkedList<Type>::Iterator : public CompactLinkedList<Type>::ConstIterator
+{
+    friend CompactLinkedList<Type>;
+public:
+    using pointer = typename CompactLinkedList::pointer;
+    using reference = typename CompactLinkedList::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other)
+        : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_COMPACTLINKEDLIST_H
@@ -0,0 +1,375 @@
+#ifndef AISDI_LINEAR_FORWARDLIST_H
+#define AISDI_LINEAR_FORWARDLIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+// Singly linked list for forward-only use such as queues: a node holds one link, there is no prev
+// to maintain. Like std::forward_list it inserts and erases after a position; beforeBegin() is
+// the position in front of the first item. A tail pointer makes append O(1).
+template <typename Type>
+class ForwardList
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+private:
+    class Node
+    {
+    public:
+        Node() :next(nullptr)
+        {
+
+        }
+        Node(const value_type &item) :next(nullptr), item(item)
+        {
+
+        }
+        Node(value_type &&item) :next(nullptr), item(std::move(item))
+        {
+
+        }
+        Node * next; // link first, as in LinkedList
+        value_type item;
+
+    } * head, * tail; // head is the sentinel before the first node, tail the last node (head when empty)
+    size_type count;
+
+    void linkAfter(Node * position, Node * node)
+    {
+        node->next = position->next;
+        position->next = node;
+        if(position == tail)
+            tail = node;
+        ++count;
+    }
+
+    void unlinkAfter(Node * position)
+    {
+        Node * node = position->next;
+        position->next = node->next;
+        if(node == tail)
+            tail = position;
+        --count;
+        delete node;
+    }
+
+public:
+    ForwardList() : head(new Node()), count(0)
+    {
+        tail = head;
+    }
+
+    ForwardList(std::initializer_list<Type> l) : ForwardList()
+    {
+        for(auto p = l.begin(); p != l.end(); ++p)
+            append(*p);
+    }
+
+    ForwardList(const ForwardList& other) : ForwardList()
+    {
+        for(auto i = other.cbegin(); i != other.cend(); ++i)
+            append(*i);
+    }
+
+    ForwardList(ForwardList&& other) : ForwardList()
+    {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+    }
+
+    ~ForwardList()
+    {
+        while(head)
+        {
+            Node * next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    ForwardList& operator=(const ForwardList& other)
+    {
+        if(this == &other)
+            return *this;
+
+        clear();
+        for(auto it = other.begin(); it != other.end(); ++it)
+            append(*it);
+
+        return *this;
+    }
+
+    ForwardList& operator=(ForwardList&& other)
+    {
+        if(this == &other)
+            return *this;
+
+        clear();
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return count == 0;
+    }
+
+    size_type getSize() const
+    {
+        return count;
+    }
+
+    void append(const Type& item)
+    {
+        linkAfter(tail, new Node(item));
+    }
+
+    void append(Type&& item)
+    {
+        linkAfter(tail, new Node(std::move(item)));
+    }
+
+    void prepend(const Type& item)
+    {
+        linkAfter(head, new Node(item));
+    }
+
+    void prepend(Type&& item)
+    {
+        linkAfter(head, new Node(std::move(item)));
+    }
+
+    // inserts after position, beforeBegin() included
+    void insertAfter(const const_iterator& position, const Type& item)
+    {
+        if(position.current == nullptr)
+            throw std::out_of_range("Attempt to insert after end()");
+        linkAfter(position.current, new Node(item));
+    }
+
+    void insertAfter(const const_iterator& position, Type&& item)
+    {
+        if(position.current == nullptr)
+            throw std::out_of_range("Attempt to insert after end()");
+        linkAfter(position.current, new Node(std::move(item)));
+    }
+
+    // The item is moved out when that cannot throw (or it cannot be copied), else copied,
+    // so that a throwing copy leaves the list as it was.
+    Type popFirst()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+
+        value_type returned(std::move_if_noexcept(head->next->item));
+        unlinkAfter(head);
+
+        return returned;
+    }
+
+    // erases the item after position, beforeBegin() included
+    void eraseAfter(const const_iterator& position)
+    {
+        if(position.current == nullptr || position.current->next == nullptr)
+            throw std::out_of_range("Attempt to erase an item out of scope or the container is empty");
+        unlinkAfter(position.current);
+    }
+
+    // erases the items in (firstExcluded, lastExcluded)
+    void eraseAfter(const const_iterator& firstExcluded, const const_iterator& lastExcluded)
+    {
+        if(firstExcluded.current == nullptr)
+            throw std::out_of_range("Attempt to erase an item out of scope or the container is empty");
+        while(firstExcluded.current->next != lastExcluded.current)
+            eraseAfter(firstExcluded);
+    }
+
+    void clear()
+    {
+        while(!isEmpty())
+            unlinkAfter(head);
+    }
+
+    iterator beforeBegin()
+    {
+        return const_iterator(head, this);
+    }
+
+    const_iterator cbeforeBegin() const
+    {
+        return const_iterator(head, this);
+    }
+
+    const_iterator beforeBegin() const
+    {
+        return cbeforeBegin();
+    }
+
+    iterator begin()
+    {
+        return const_iterator(head->next, this);
+    }
+
+    iterator end()
+    {
+        return const_iterator(nullptr, this);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(head->next, this);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(nullptr, this);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+class ForwardList<Type>::ConstIterator
+{
+    friend ForwardList<Type>;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename ForwardList::value_type;
+    using difference_type = typename ForwardList::difference_type;
+    using pointer = typename ForwardList::const_pointer;
+    using reference = typename ForwardList::const_reference;
+
+protected:
+    Node * current; // nullptr for end()
+    const ForwardList * owner; // tells beforeBegin() apart
+
+    ConstIterator(Node * node, const ForwardList * list) : current(node), owner(list)
+    {
+
+    }
+
+public:
+    explicit ConstIterator() : current(nullptr), owner(nullptr)
+    {}
+
+    reference operator*() const
+    {
+        if(current == nullptr)
+            throw std::out_of_range("Attempt to dereference the end() iterator");
+        if(current == owner->head)
+            throw std::out_of_range("Attempt to dereference the beforeBegin() iterator");
+        return current->item;
+    }
+
+    ConstIterator& operator++()
+    {
+        if(current == nullptr)
+            throw std::out_of_range("Attempt to increment the end() itertator");
+        current = current->next;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        auto result = *this;
+        ++(*this);
+        return result;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        auto it = *this;
+        for(difference_type i = 0; i < d; ++i)
+        {
+            if(it.current == nullptr)
+                throw std::range_error("Attempt to move the iterator beyond end()");
+            it.current = it.current->next;
+        }
+        return it;
+    }
+
+    // end() of every list is nullptr
+    bool operator==(const ConstIterator& other) const
+    {
+        return owner == other.owner && current == other.current;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class ForwardList<Type>::Iterator : public ForwardList<Type>::ConstIterator
+{
+    friend ForwardList<Type>;
+public:
+    using pointer = typename ForwardList::pointer;
+    using reference = typename ForwardList::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other)
+        : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_FORWARDLIST_H
@@ -0,0 +1,223 @@
+#ifndef AISDI_LINEAR_GENERATIONALSLOTS_H
+#define AISDI_LINEAR_GENERATIONALSLOTS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// Reference handed out by a container built on GenerationalSlots, only the Owner makes and reads them.
+// One type per Owner, so that a handle of one kind of container does not compile with another.
+template <typename Owner>
+class GenerationalHandle
+{
+    friend Owner;
+public:
+    GenerationalHandle() : slot(0xFFFFFFFFu), generation(0)
+    {
+
+    }
+
+    bool operator==(const GenerationalHandle& other) const
+    {
+        return slot == other.slot && generation == other.generation;
+    }
+
+    bool operator!=(const GenerationalHandle& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    GenerationalHandle(std::uint32_t initSlot, std::uint32_t initGeneration) : slot(initSlot), generation(initGeneration)
+    {
+
+    }
+
+    std::uint32_t slot;
+    std::uint32_t generation;
+};
+
+// Slots holding a Target each (a position, a node pointer) behind generation-checked references.
+// A released slot is reused with its generation bumped, so that a handle to its former target
+// no longer resolves. Generations wrap after 2^32 reuses of one slot. Slots start at firstGeneration:
+// a table replacing an earlier one starts past that one's getNextGeneration(), so that handles
+// of the earlier table stay stale. Target has to be default constructible and nothrow copyable.
+template <typename Target>
+class GenerationalSlots
+{
+public:
+    using size_type = std::size_t;
+    static const std::uint32_t none = 0xFFFFFFFFu;
+
+    explicit GenerationalSlots(std::uint32_t initFirstGeneration = 0) : slots(nullptr), capacity(0), used(0),
+        freeHead(none), live(0), firstGeneration(initFirstGeneration)
+    {
+
+    }
+
+    GenerationalSlots(const GenerationalSlots& other) : slots(nullptr), capacity(0), used(other.used),
+        freeHead(other.freeHead), live(other.live), firstGeneration(other.firstGeneration)
+    {
+        if(other.capacity == 0)
+            return;
+        slots = new Slot [other.capacity];
+        capacity = other.capacity;
+        for(size_type i = 0; i < capacity; ++i)
+            slots[i] = other.slots[i];
+    }
+
+    GenerationalSlots(GenerationalSlots&& other) : slots(other.slots), capacity(other.capacity), used(other.used),
+        freeHead(other.freeHead), live(other.live), firstGeneration(other.firstGeneration)
+    {
+        other.slots = nullptr;
+        other.capacity = 0;
+        other.used = 0;
+        other.freeHead = none;
+        other.live = 0;
+    }
+
+    GenerationalSlots& operator=(GenerationalSlots other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~GenerationalSlots()
+    {
+        delete [] slots;
+    }
+
+    void swap(GenerationalSlots& other)
+    {
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(used, other.used);
+        std::swap(freeHead, other.freeHead);
+        std::swap(live, other.live);
+        std::swap(firstGeneration, other.firstGeneration);
+    }
+
+    // slots in use
+    size_type getSize() const
+    {
+        return live;
+    }
+
+    // makes the next count acquire() calls nothrow
+    void reserve(size_type count)
+    {
+        while(capacity - live < count)
+            grow();
+    }
+
+    // a slot now holding target
+    std::uint32_t acquire(const Target& target)
+    {
+        std::uint32_t slot = freeHead;
+        if(slot != none)
+        {
+            freeHead = slots[slot].nextFree;
+        }
+        else
+        {
+            if(used == capacity)
+                grow();
+            slot = static_cast<std::uint32_t>(used++);
+        }
+        slots[slot].target = target;
+        ++live;
+        return slot;
+    }
+
+    // the handles to slot go stale
+    void release(std::uint32_t slot)
+    {
+        slots[slot].target = Target();
+        ++slots[slot].generation;
+        slots[slot].nextFree = freeHead;
+        freeHead = slot;
+        --live;
+    }
+
+    // slot has to be in use
+    Target& operator[](std::uint32_t slot)
+    {
+        return slots[slot].target;
+    }
+
+    const Target& operator[](std::uint32_t slot) const
+    {
+        return slots[slot].target;
+    }
+
+    std::uint32_t generationOf(std::uint32_t slot) const
+    {
+        return slots[slot].generation;
+    }
+
+    // false for stale handles: a free slot is already at the generation of its next target
+    bool isCurrent(std::uint32_t slot, std::uint32_t generation) const
+    {
+        return slot < used && slots[slot].generation == generation;
+    }
+
+    // past the generation of every handle issued so far; O(slots)
+    std::uint32_t getNextGeneration() const
+    {
+        std::uint32_t next = firstGeneration;
+        for(size_type i = 0; i < used; ++i)
+            next = std::max<std::uint32_t>(next, slots[i].generation + 1);
+        return next;
+    }
+
+    size_type getMemoryUsage() const
+    {
+        return capacity * sizeof(Slot);
+    }
+
+private:
+    struct Slot
+    {
+        Target target;
+        std::uint32_t generation;
+        std::uint32_t nextFree; // meaningful while free
+    };
+
+    Slot * slots;
+    size_type capacity;
+    size_type used; // slots ever handed out
+    std::uint32_t freeHead;
+    size_type live;
+    std::uint32_t firstGeneration;
+
+    void grow()
+    {
+        if(capacity >= none)
+            throw std::length_error("Too many generational slots");
+        size_type newCapacity = capacity ? capacity * 2 : 16;
+        if(newCapacity > none)
+            newCapacity = none;
+        Slot * newSlots = new Slot [newCapacity];
+        for(size_type i = 0; i < used; ++i)
+            newSlots[i] = slots[i];
+        for(size_type i = used; i < newCapacity; ++i)
+            newSlots[i] = Slot { Target(), firstGeneration, none };
+        delete [] slots;
+        slots = newSlots;
+        capacity = newCapacity;
+    }
+};
+
+} // namespace detail
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_GENERATIONALSLOTS_H
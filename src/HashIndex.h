@@ -0,0 +1,275 @@
+#ifndef AISDI_LINEAR_HASHINDEX_H
+#define AISDI_LINEAR_HASHINDEX_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "NodePayload.h"
+
+namespace aisdi
+{
+
+// Open-addressing hash map from Key to a small Mapped value (an iterator, a pointer, an index),
+// meant as a secondary index over the linear containers. Linear probing over a power-of-two table
+// kept at most 3/4 full; erase shifts the following entries back, so there are no tombstones.
+// Next to every slot the (mixed) hash is stored, 0 marking an empty slot.
+template <typename Key, typename Mapped, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class HashIndex
+{
+public:
+    using size_type = std::size_t;
+    using key_type = Key;
+    using mapped_type = Mapped;
+
+private:
+    struct Entry
+    {
+        Key key;
+        Mapped mapped;
+    };
+    using EntryStorage = typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type;
+
+    static const std::size_t occupiedBit = ~(~std::size_t(0) >> 1);
+
+    std::size_t * hashes;
+    EntryStorage * entries;
+    size_type capacity;
+    size_type count;
+    Hash hasher;
+    KeyEqual equal;
+
+    // std::hash of integers is the identity, the multiplication spreads it over the low bits used as index
+    std::size_t hashOf(const Key& key) const
+    {
+        std::size_t h = hasher(key) * static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+        h ^= h >> (sizeof(std::size_t) * 4);
+        return h | occupiedBit;
+    }
+
+    Entry& entryAt(size_type slot)
+    {
+        return *reinterpret_cast<Entry *>(&entries[slot]);
+    }
+
+    const Entry& entryAt(size_type slot) const
+    {
+        return *reinterpret_cast<const Entry *>(&entries[slot]);
+    }
+
+    size_type mask() const
+    {
+        return capacity - 1;
+    }
+
+    // slot holding key, or the empty slot ending its probe sequence
+    size_type probe(const Key& key, std::size_t h) const
+    {
+        size_type slot = h & mask();
+        while(hashes[slot] != 0 && !(hashes[slot] == h && equal(entryAt(slot).key, key)))
+            slot = (slot + 1) & mask();
+        return slot;
+    }
+
+    // the members change only once both arrays are allocated, so a throwing allocation leaves them as they were
+    void allocate(size_type newCapacity)
+    {
+        std::size_t * newHashes = new std::size_t [newCapacity]();
+        EntryStorage * newEntries;
+        try
+        {
+            newEntries = static_cast<EntryStorage *>(::operator new(sizeof(EntryStorage) * newCapacity));
+        }
+        catch(...)
+        {
+            delete [] newHashes;
+            throw;
+        }
+        hashes = newHashes;
+        entries = newEntries;
+        capacity = newCapacity;
+    }
+
+    void release()
+    {
+        for(size_type slot = 0; slot < capacity; ++slot)
+        {
+            if(hashes[slot] != 0)
+                entryAt(slot).~Entry();
+        }
+        delete [] hashes;
+        ::operator delete(entries);
+    }
+
+    // entries are moved, Key and Mapped are expected not to throw on move
+    void rehash(size_type newCapacity)
+    {
+        std::size_t * oldHashes = hashes;
+        EntryStorage * oldEntries = entries;
+        size_type oldCapacity = capacity;
+        allocate(newCapacity);
+        for(size_type slot = 0; slot < oldCapacity; ++slot)
+        {
+            if(oldHashes[slot] == 0)
+                continue;
+            Entry& entry = *reinterpret_cast<Entry *>(&oldEntries[slot]);
+            size_type target = oldHashes[slot] & mask();
+            while(hashes[target] != 0)
+                target = (target + 1) & mask();
+            new (&entries[target]) Entry(std::move(entry));
+            hashes[target] = oldHashes[slot];
+            entry.~Entry();
+        }
+        delete [] oldHashes;
+        ::operator delete(oldEntries);
+    }
+
+public:
+    explicit HashIndex(size_type expectedSize = 0, const Hash& hash = Hash(), const KeyEqual& keyEqual = KeyEqual())
+        : count(0), hasher(hash), equal(keyEqual)
+    {
+        size_type initialCapacity = 8;
+        while(initialCapacity / 4 * 3 < expectedSize)
+            initialCapacity *= 2;
+        allocate(initialCapacity);
+    }
+
+    HashIndex(const HashIndex&) = delete;
+    HashIndex& operator=(const HashIndex&) = delete;
+
+    ~HashIndex()
+    {
+        release();
+    }
+
+    bool isEmpty() const
+    {
+        return count == 0;
+    }
+
+    size_type getSize() const
+    {
+        return count;
+    }
+
+    // number of slots
+    size_type getCapacity() const
+    {
+        return capacity;
+    }
+
+    // bytes held by the table
+    size_type getMemoryUsage() const
+    {
+        return capacity * (sizeof(std::size_t) + sizeof(EntryStorage));
+    }
+
+    // nullptr when key is absent; the pointer is valid until the next insert or erase
+    Mapped * find(const Key& key)
+    {
+        size_type slot = probe(key, hashOf(key));
+        return hashes[slot] != 0 ? &entryAt(slot).mapped : nullptr;
+    }
+
+    const Mapped * find(const Key& key) const
+    {
+        size_type slot = probe(key, hashOf(key));
+        return hashes[slot] != 0 ? &entryAt(slot).mapped : nullptr;
+    }
+
+    bool contains(const Key& key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    // starts fetching the first slot key would be looked up in, see LruCache::getMany()
+    void prefetch(const Key& key) const
+    {
+        size_type slot = hashOf(key) & mask();
+        detail::prefetch(&hashes[slot]);
+        detail::prefetch(&entries[slot]);
+    }
+
+    // room for size keys in total, so that inserting up to that many does not rehash (nor throw)
+    void reserve(size_type size)
+    {
+        size_type newCapacity = capacity;
+        while(newCapacity / 4 * 3 < size)
+            newCapacity *= 2;
+        if(newCapacity != capacity)
+            rehash(newCapacity);
+    }
+
+    // returns false and leaves the index unchanged when key is already present
+    bool insert(const Key& key, const Mapped& mapped)
+    {
+        std::size_t h = hashOf(key);
+        size_type slot = probe(key, h);
+        if(hashes[slot] != 0)
+            return false;
+        if(count + 1 > capacity / 4 * 3)
+        {
+            rehash(capacity * 2);
+            slot = probe(key, h);
+        }
+        new (&entries[slot]) Entry { key, mapped };
+        hashes[slot] = h;
+        ++count;
+        return true;
+    }
+
+    // returns false when key is absent
+    bool erase(const Key& key)
+    {
+        size_type slot = probe(key, hashOf(key));
+        if(hashes[slot] == 0)
+            return false;
+        entryAt(slot).~Entry();
+        hashes[slot] = 0;
+        --count;
+
+        // backward shift: entries after the hole which may live in it move there
+        size_type hole = slot;
+        for(size_type next = (slot + 1) & mask(); hashes[next] != 0; next = (next + 1) & mask())
+        {
+            size_type home = hashes[next] & mask();
+            if(((next - home) & mask()) < ((next - hole) & mask()))
+                continue; // its home lies after the hole
+            new (&entries[hole]) Entry(std::move(entryAt(next)));
+            hashes[hole] = hashes[next];
+            entryAt(next).~Entry();
+            hashes[next] = 0;
+            hole = next;
+        }
+        return true;
+    }
+
+    void clear()
+    {
+        for(size_type slot = 0; slot < capacity; ++slot)
+        {
+            if(hashes[slot] != 0)
+            {
+                entryAt(slot).~Entry();
+                hashes[slot] = 0;
+            }
+        }
+        count = 0;
+    }
+
+    void swap(HashIndex& other)
+    {
+        std::swap(hashes, other.hashes);
+        std::swap(entries, other.entries);
+        std::swap(capacity, other.capacity);
+        std::swap(count, other.count);
+        std::swap(hasher, other.hasher);
+        std::swap(equal, other.equal);
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_HASHINDEX_H
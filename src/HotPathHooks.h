@@ -0,0 +1,26 @@
+#ifndef AISDI_LINEAR_HOTPATHHOOKS_H
+#define AISDI_LINEAR_HOTPATHHOOKS_H
+
+// The hooks Vector and LinkedList put on their costly paths. With AISDI_LINEAR_HOT_PATH_TRACE
+// defined (in every translation unit, e.g. cmake -DAISDI_LINEAR_HOT_PATH_TRACE=ON), a hook times
+// the rest of its scope into the ring of the calling thread, see HotPathTrace.h. Without it, a
+// hook is an unevaluated sizeof: no code, not even for its arguments, and no includes.
+
+#ifdef AISDI_LINEAR_HOT_PATH_TRACE
+
+#include "HotPathTrace.h"
+
+#define AISDI_LINEAR_HOT_PATH(kind, container, elements) \
+    ::aisdi::detail::HotPathScope aisdiHotPathScope(::aisdi::HotPathEventKind::kind, container, elements)
+
+// replaces the elements of the hook above in the same scope, for paths that count them as they go
+#define AISDI_LINEAR_HOT_PATH_ELEMENTS(elements) aisdiHotPathScope.setElements(elements)
+
+#else
+
+#define AISDI_LINEAR_HOT_PATH(kind, container, elements) static_cast<void>(sizeof(elements))
+#define AISDI_LINEAR_HOT_PATH_ELEMENTS(elements) static_cast<void>(sizeof(elements))
+
+#endif
+
+#endif // AISDI_LINEAR_HOTPATHHOOKS_H
@@ -0,0 +1,290 @@
+#ifndef AISDI_LINEAR_HOTPATHTRACE_H
+#define AISDI_LINEAR_HOTPATHTRACE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace aisdi
+{
+
+// The costly moments of Vector and LinkedList, recorded when they are built with
+// AISDI_LINEAR_HOT_PATH_TRACE defined (see HotPathHooks.h), so that a stall can be told apart:
+// a reallocation or a long range erase shows as a slice on a timeline.
+enum class HotPathEventKind : std::uint8_t
+{
+    reallocation, // Vector growth, LinkedList::defragment()
+    rangeErase,
+    bulkCopy, // copy construction or assignment of a whole container
+    traversal // a walk of LinkedList nodes or a shift of Vector elements, long ones only
+};
+
+inline const char * hotPathEventName(HotPathEventKind kind)
+{
+    switch(kind)
+    {
+    case HotPathEventKind::reallocation:
+        return "reallocation";
+    case HotPathEventKind::rangeErase:
+        return "rangeErase";
+    case HotPathEventKind::bulkCopy:
+        return "bulkCopy";
+    case HotPathEventKind::traversal:
+        return "traversal";
+    }
+    return "unknown";
+}
+
+struct HotPathEvent
+{
+    HotPathEventKind kind;
+    const char * container; // a string literal
+    std::uint64_t startNs; // since the first use of the tracer
+    std::uint64_t durationNs;
+    std::uint64_t elements; // moved, erased, copied or walked over
+    std::uint32_t threadId; // 1 for the first thread recording, and so on
+};
+
+// Events of one thread, the latest capacity of them. Only the owning thread records, without
+// locks or waiting; any thread may collect meanwhile. Every slot carries the number of the event
+// it holds, set after the event is written (a seqlock), so a collector skips slots being
+// overwritten. The fields are relaxed atomics, so that reading one being written is not a race.
+class HotPathRing
+{
+public:
+    static const std::size_t capacity = 4096; // a power of two
+
+    explicit HotPathRing(std::uint32_t initThreadId) : recorded(0), threadId(initThreadId)
+    {
+
+    }
+
+    HotPathRing(const HotPathRing&) = delete;
+    HotPathRing& operator=(const HotPathRing&) = delete;
+
+    void record(HotPathEventKind kind, const char * container, std::uint64_t startNs, std::uint64_t durationNs,
+                std::uint64_t elements)
+    {
+        const std::uint64_t number = recorded.load(std::memory_order_relaxed);
+        Slot& slot = slots[number & (capacity - 1)];
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.kind.store(static_cast<std::uint8_t>(kind), std::memory_order_relaxed);
+        slot.container.store(container, std::memory_order_relaxed);
+        slot.startNs.store(startNs, std::memory_order_relaxed);
+        slot.durationNs.store(durationNs, std::memory_order_relaxed);
+        slot.elements.store(elements, std::memory_order_relaxed);
+        slot.sequence.store(number + 1, std::memory_order_release);
+        recorded.store(number + 1, std::memory_order_release);
+    }
+
+    // appends the events still held, oldest first
+    void collect(std::vector<HotPathEvent>& events) const
+    {
+        const std::uint64_t end = recorded.load(std::memory_order_acquire);
+        for(std::uint64_t number = end > capacity ? end - capacity : 0; number < end; ++number)
+        {
+            const Slot& slot = slots[number & (capacity - 1)];
+            if(slot.sequence.load(std::memory_order_acquire) != number + 1)
+                continue;
+            HotPathEvent event { static_cast<HotPathEventKind>(slot.kind.load(std::memory_order_relaxed)),
+                                 slot.container.load(std::memory_order_relaxed),
+                                 slot.startNs.load(std::memory_order_relaxed),
+                                 slot.durationNs.load(std::memory_order_relaxed),
+                                 slot.elements.load(std::memory_order_relaxed), threadId };
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot.sequence.load(std::memory_order_relaxed) == number + 1)
+                events.push_back(event);
+        }
+    }
+
+    // including the ones overwritten since
+    std::uint64_t getRecorded() const
+    {
+        return recorded.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Slot
+    {
+        Slot() : sequence(0), kind(0), container(nullptr), startNs(0), durationNs(0), elements(0)
+        {
+
+        }
+
+        std::atomic<std::uint64_t> sequence; // number of the event held plus one, 0: none or being written
+        std::atomic<std::uint8_t> kind;
+        std::atomic<const char *> container;
+        std::atomic<std::uint64_t> startNs;
+        std::atomic<std::uint64_t> durationNs;
+        std::atomic<std::uint64_t> elements;
+    };
+
+    std::atomic<std::uint64_t> recorded;
+    const std::uint32_t threadId;
+    Slot slots[capacity];
+};
+
+// The rings of all threads which recorded. A thread gets its ring on its first event (the only
+// moment a lock is taken); rings are kept after their threads end, so their events can be exported.
+class HotPathTracer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static HotPathTracer& instance()
+    {
+        static HotPathTracer tracer;
+        return tracer;
+    }
+
+    HotPathTracer(const HotPathTracer&) = delete;
+    HotPathTracer& operator=(const HotPathTracer&) = delete;
+
+    HotPathRing& threadRing()
+    {
+        static thread_local HotPathRing * ring = nullptr;
+        if(!ring)
+            ring = addRing();
+        return *ring;
+    }
+
+    std::uint64_t sinceEpoch(Clock::time_point time) const
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch).count());
+    }
+
+    // the events held by all rings, by start time
+    std::vector<HotPathEvent> snapshot() const
+    {
+        std::vector<HotPathEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(const std::unique_ptr<HotPathRing>& ring : rings)
+                ring->collect(events);
+        }
+        std::stable_sort(events.begin(), events.end(), [](const HotPathEvent& left, const HotPathEvent& right)
+        {
+            return left.startNs < right.startNs;
+        });
+        return events;
+    }
+
+    // events overwritten in full rings before they were exported
+    std::uint64_t getDropped() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::uint64_t dropped = 0;
+        for(const std::unique_ptr<HotPathRing>& ring : rings)
+        {
+            const std::uint64_t recorded = ring->getRecorded();
+            dropped += recorded > HotPathRing::capacity ? recorded - HotPathRing::capacity : 0;
+        }
+        return dropped;
+    }
+
+private:
+    const Clock::time_point epoch;
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<HotPathRing>> rings;
+
+    HotPathTracer() : epoch(Clock::now())
+    {
+
+    }
+
+    HotPathRing * addRing()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rings.push_back(std::unique_ptr<HotPathRing>(new HotPathRing(static_cast<std::uint32_t>(rings.size() + 1))));
+        return rings.back().get();
+    }
+};
+
+// Chrome Trace Event JSON (chrome://tracing, ui.perfetto.dev): one complete ("X") event per
+// event, named e.g. "Vector reallocation", times in microseconds.
+inline void writeChromeTrace(std::ostream& out, const std::vector<HotPathEvent>& events)
+{
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    for(std::size_t i = 0; i < events.size(); ++i)
+    {
+        const HotPathEvent& event = events[i];
+        out << (i ? ",\n  " : "\n  ") << "{\"name\": \"" << event.container << " " << hotPathEventName(event.kind)
+            << "\", \"cat\": \"" << hotPathEventName(event.kind) << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": "
+            << event.threadId << ", \"ts\": " << event.startNs / 1000.0 << ", \"dur\": " << event.durationNs / 1000.0
+            << ", \"args\": {\"elements\": " << event.elements << "}}";
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+// all events held so far
+inline void exportChromeTrace(std::ostream& out)
+{
+    writeChromeTrace(out, HotPathTracer::instance().snapshot());
+}
+
+namespace detail
+{
+
+#ifndef AISDI_LINEAR_HOT_PATH_MIN_TRAVERSAL
+#define AISDI_LINEAR_HOT_PATH_MIN_TRAVERSAL 1024
+#endif
+
+// Times its scope and records it on destruction; shorter traversals than
+// AISDI_LINEAR_HOT_PATH_MIN_TRAVERSAL elements are not even timed.
+class HotPathScope
+{
+public:
+    HotPathScope(HotPathEventKind initKind, const char * initContainer, std::uint64_t initElements)
+        : kind(initKind), container(initContainer), elements(initElements),
+          active(initKind != HotPathEventKind::traversal || initElements >= AISDI_LINEAR_HOT_PATH_MIN_TRAVERSAL)
+    {
+        if(active)
+            start = HotPathTracer::Clock::now();
+    }
+
+    HotPathScope(const HotPathScope&) = delete;
+    HotPathScope& operator=(const HotPathScope&) = delete;
+
+    // whether a traversal is recorded is decided by the elements given to the constructor
+    void setElements(std::uint64_t newElements)
+    {
+        elements = newElements;
+    }
+
+    ~HotPathScope()
+    {
+        if(!active)
+            return;
+        const HotPathTracer::Clock::time_point end = HotPathTracer::Clock::now();
+        HotPathTracer& tracer = HotPathTracer::instance();
+        tracer.threadRing().record(kind, container, tracer.sinceEpoch(start),
+                                   static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()),
+                                   elements);
+    }
+
+private:
+    const HotPathEventKind kind;
+    const char * const container;
+    std::uint64_t elements;
+    const bool active;
+    HotPathTracer::Clock::time_point start;
+};
+
+} // namespace detail
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_HOTPATHTRACE_H
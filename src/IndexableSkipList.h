@@ -0,0 +1,261 @@
+#ifndef AISDI_LINEAR_INDEXABLESKIPLIST_H
+#define AISDI_LINEAR_INDEXABLESKIPLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace aisdi
+{
+
+// Positional index over an external sequence (e.g. LinkedList nodes), identified by Key.
+// Elements have 1-based ranks; rank 0 is the header, rank size + 1 the end key given at construction.
+// About a quarter of the elements get a tower, each tower link stores its span (rank distance),
+// the gaps between towers are walked by the owner of the sequence.
+template <typename Key>
+class IndexableSkipList
+{
+public:
+    using size_type = std::size_t;
+    static const size_type maxHeight = 16; // enough for 4^16 elements with p = 1/4
+
+private:
+    class Tower;
+
+    struct Link
+    {
+        Tower * next;
+        Tower * prev;
+        size_type span;
+    };
+
+    class Tower
+    {
+    public:
+        Tower(const Key& initKey, size_type initHeight) : key(initKey), height(initHeight), links(new Link [initHeight])
+        {
+
+        }
+
+        ~Tower()
+        {
+            delete [] links;
+        }
+
+        Tower(const Tower&) = delete;
+        Tower& operator=(const Tower&) = delete;
+
+        Key key;
+        size_type height;
+        Link * links;
+    };
+
+    Tower header;
+    Tower tail;
+    size_type size;
+    std::unordered_map<Key, Tower *> towers;
+    std::uint32_t randomState;
+
+    size_type randomHeight()
+    {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+        std::uint32_t bits = randomState;
+        size_type height = 0;
+        while((bits & 3) == 0 && height < maxHeight) // each level with probability 1/4
+        {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // for every level, the last tower whose rank is <= target, and that tower's rank
+    void findPredecessors(size_type target, Tower ** update, size_type * updateRank)
+    {
+        Tower * tower = &header;
+        size_type rank = 0;
+        for(size_type level = maxHeight; level-- > 0; )
+        {
+            while(tower->links[level].next && rank + tower->links[level].span <= target)
+            {
+                rank += tower->links[level].span;
+                tower = tower->links[level].next;
+            }
+            update[level] = tower;
+            updateRank[level] = rank;
+        }
+    }
+
+    void resetLinks()
+    {
+        for(size_type level = 0; level < maxHeight; ++level)
+        {
+            header.links[level] = Link { &tail, nullptr, 1 };
+            tail.links[level] = Link { nullptr, &header, 0 };
+        }
+        size = 0;
+    }
+
+    void clear()
+    {
+        Tower * tower = header.links[0].next;
+        while(tower != &tail)
+        {
+            Tower * next = tower->links[0].next;
+            delete tower;
+            tower = next;
+        }
+        towers.clear();
+        towers[tail.key] = &tail;
+        resetLinks();
+    }
+
+public:
+    explicit IndexableSkipList(const Key& endKey)
+        : header(Key(), maxHeight), tail(endKey, maxHeight), size(0), randomState(0x9E3779B9u)
+    {
+        resetLinks();
+        towers[endKey] = &tail;
+    }
+
+    IndexableSkipList(const IndexableSkipList&) = delete;
+    IndexableSkipList& operator=(const IndexableSkipList&) = delete;
+
+    ~IndexableSkipList()
+    {
+        clear();
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    bool hasTower(const Key& key) const
+    {
+        return towers.find(key) != towers.end();
+    }
+
+    // key has to have a tower (the end key always has one); expected O(log n)
+    size_type rankOf(const Key& key) const
+    {
+        const Tower * tower = towers.find(key)->second;
+        if(tower == &tail)
+            return size + 1;
+        size_type rank = 0;
+        while(tower != &header)
+        {
+            const Link& top = tower->links[tower->height - 1];
+            rank += top.prev->links[tower->height - 1].span;
+            tower = top.prev;
+        }
+        return rank;
+    }
+
+    // the towered element with the greatest rank <= rank; (Key(), 0) stands for the header
+    std::pair<Key, size_type> floor(size_type rank) const
+    {
+        const Tower * tower = &header;
+        size_type towerRank = 0;
+        for(size_type level = maxHeight; level-- > 0; )
+        {
+            while(tower->links[level].next && towerRank + tower->links[level].span <= rank)
+            {
+                towerRank += tower->links[level].span;
+                tower = tower->links[level].next;
+            }
+        }
+        return std::make_pair(tower->key, towerRank);
+    }
+
+    // the element known as key is known as newKey from now on, its rank does not change
+    void rekey(const Key& key, const Key& newKey)
+    {
+        auto found = towers.find(key);
+        if(found == towers.end())
+            return;
+        Tower * tower = found->second;
+        towers[newKey] = tower; // may throw, nothing is changed then
+        towers.erase(key);
+        tower->key = newKey;
+    }
+
+    // a new element is placed at rank (1..size + 1), elements from rank on move one rank up
+    void insert(const Key& key, size_type rank)
+    {
+        Tower * update[maxHeight];
+        size_type updateRank[maxHeight];
+        if(rank == size + 1) // appending, predecessors are known from the tail
+        {
+            for(size_type level = 0; level < maxHeight; ++level)
+            {
+                update[level] = tail.links[level].prev;
+                updateRank[level] = rank - update[level]->links[level].span;
+            }
+        }
+        else
+        {
+            findPredecessors(rank - 1, update, updateRank);
+        }
+
+        size_type height = randomHeight();
+        Tower * tower = height ? new Tower(key, height) : nullptr;
+        for(size_type level = 0; level < maxHeight; ++level)
+        {
+            Link& link = update[level]->links[level];
+            if(level < height)
+            {
+                Tower * next = link.next;
+                tower->links[level] = Link { next, update[level], updateRank[level] + link.span + 1 - rank };
+                link.span = rank - updateRank[level];
+                link.next = tower;
+                next->links[level].prev = tower;
+            }
+            else
+            {
+                ++link.span;
+            }
+        }
+        if(tower)
+            towers[key] = tower;
+        ++size;
+    }
+
+    // the element with key at rank is removed, elements after it move one rank down
+    void erase(const Key& key, size_type rank)
+    {
+        Tower * update[maxHeight];
+        size_type updateRank[maxHeight];
+        findPredecessors(rank - 1, update, updateRank);
+
+        auto found = towers.find(key);
+        Tower * tower = found != towers.end() ? found->second : nullptr;
+        for(size_type level = 0; level < maxHeight; ++level)
+        {
+            Link& link = update[level]->links[level];
+            if(tower && level < tower->height)
+            {
+                link.span += tower->links[level].span - 1;
+                link.next = tower->links[level].next;
+                link.next->links[level].prev = update[level];
+            }
+            else
+            {
+                --link.span;
+            }
+        }
+        if(tower)
+        {
+            towers.erase(found);
+            delete tower;
+        }
+        --size;
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_INDEXABLESKIPLIST_H
@@ -0,0 +1,476 @@
+#ifndef AISDI_LINEAR_INTRUSIVELINKEDLIST_H
+#define AISDI_LINEAR_INTRUSIVELINKEDLIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include "ListLinks.h"
+
+namespace aisdi
+{
+
+class IntrusiveListBase;
+
+// Member to be embedded in objects stored in an IntrusiveLinkedList, one hook per list
+// the object may be in at the same time. With autoUnlink the object leaves its list when destroyed,
+// otherwise it has to be erased before destruction.
+class IntrusiveListHook
+{
+    friend IntrusiveListBase;
+    template <typename Link> friend void detail::unlinkRange(Link *&, Link *, Link *);
+    template <typename Link> friend void detail::linkRangeBefore(Link *&, Link *, Link *, Link *);
+public:
+    enum UnlinkMode { manualUnlink, autoUnlink };
+
+    explicit IntrusiveListHook(UnlinkMode mode = manualUnlink)
+        : next(nullptr), prev(nullptr), owner(nullptr), autoUnlinking(mode == autoUnlink)
+    {
+
+    }
+
+    // a copied object is not in any list
+    IntrusiveListHook(const IntrusiveListHook& other)
+        : next(nullptr), prev(nullptr), owner(nullptr), autoUnlinking(other.autoUnlinking)
+    {
+
+    }
+
+    // assigning objects does not move them between lists
+    IntrusiveListHook& operator=(const IntrusiveListHook&)
+    {
+        return *this;
+    }
+
+    inline ~IntrusiveListHook();
+
+    bool isLinked() const
+    {
+        return owner != nullptr;
+    }
+
+    // O(1), does nothing when not linked
+    inline void unlink();
+
+private:
+    IntrusiveListHook * next;
+    IntrusiveListHook * prev;
+    IntrusiveListBase * owner;
+    bool autoUnlinking;
+};
+
+// Type-independent part of IntrusiveLinkedList, lets a hook unlink itself.
+class IntrusiveListBase
+{
+    friend IntrusiveListHook;
+public:
+    using size_type = std::size_t;
+
+    IntrusiveListBase(const IntrusiveListBase&) = delete;
+    IntrusiveListBase& operator=(const IntrusiveListBase&) = delete;
+
+    bool isEmpty() const
+    {
+        return count == 0;
+    }
+
+    size_type getSize() const
+    {
+        return count;
+    }
+
+    // unlinks all objects, the objects themselves are not touched
+    void clear()
+    {
+        while(first != &sentinel)
+            unlinkHook(first);
+    }
+
+protected:
+    IntrusiveListHook * first;
+    IntrusiveListHook sentinel; // sentinel.next stays nullptr, as in LinkedList
+    size_type count;
+    std::ptrdiff_t hookOffset; // of the hook within the linked objects, measured on a linked object
+
+    IntrusiveListBase() : first(&sentinel), count(0), hookOffset(0)
+    {
+
+    }
+
+    ~IntrusiveListBase()
+    {
+        clear();
+    }
+
+    void linkHookBefore(IntrusiveListHook * position, IntrusiveListHook * hook)
+    {
+        if(hook->owner)
+            throw std::logic_error("Attempt to link an object which is already in a list");
+        detail::linkRangeBefore(first, position, hook, hook);
+        hook->owner = this;
+        ++count;
+    }
+
+    void unlinkHook(IntrusiveListHook * hook)
+    {
+        detail::unlinkRange(first, hook, hook);
+        hook->next = nullptr;
+        hook->prev = nullptr;
+        hook->owner = nullptr;
+        --count;
+    }
+
+    bool owns(const IntrusiveListHook * hook) const
+    {
+        return hook->owner == this;
+    }
+
+    static IntrusiveListHook * nextOf(const IntrusiveListHook * hook)
+    {
+        return hook->next;
+    }
+
+    static IntrusiveListHook * prevOf(const IntrusiveListHook * hook)
+    {
+        return hook->prev;
+    }
+
+    // hook has to be linked
+    static std::ptrdiff_t hookOffsetOf(const IntrusiveListHook * hook)
+    {
+        return hook->owner->hookOffset;
+    }
+};
+
+IntrusiveListHook::~IntrusiveListHook()
+{
+    if(autoUnlinking)
+        unlink();
+}
+
+void IntrusiveListHook::unlink()
+{
+    if(owner)
+        owner->unlinkHook(this);
+}
+
+// Doubly linked list of objects which are not owned, copied or allocated by the list:
+// they are linked through their Hook member. Iterators behave like LinkedList iterators.
+// Linking and unlinking (also by object reference) is O(1) and never allocates.
+template <typename Type, IntrusiveListHook Type::* Hook>
+class IntrusiveLinkedList : public IntrusiveListBase
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+private:
+    // hook has to be linked; its list knows the offset from the objects linked so far,
+    // so that no object has to be made up to find it and Type needs no standard layout
+    static Type * objectOf(IntrusiveListHook * hook)
+    {
+        return reinterpret_cast<Type *>(reinterpret_cast<char *>(hook) - hookOffsetOf(hook));
+    }
+
+    IntrusiveListHook * hookOf(Type& object) const
+    {
+        return &(object.*Hook);
+    }
+
+    void linkBefore(IntrusiveListHook * position, Type& object)
+    {
+        IntrusiveListHook * hook = hookOf(object);
+        linkHookBefore(position, hook);
+        hookOffset = reinterpret_cast<char *>(hook) - reinterpret_cast<char *>(std::addressof(object));
+    }
+
+public:
+    IntrusiveLinkedList()
+    {
+
+    }
+
+    // unlinks the remaining objects
+    ~IntrusiveLinkedList()
+    {
+
+    }
+
+    void append(Type& object)
+    {
+        linkBefore(&sentinel, object);
+    }
+
+    void prepend(Type& object)
+    {
+        linkBefore(first, object);
+    }
+
+    void insert(const const_iterator& insertPosition, Type& object)
+    {
+        linkBefore(insertPosition.current, object);
+    }
+
+    Type& popFirst()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+        Type& object = *objectOf(first);
+        unlinkHook(first);
+        return object;
+    }
+
+    Type& popLast()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty container");
+        Type& object = *objectOf(prevOf(&sentinel));
+        unlinkHook(prevOf(&sentinel));
+        return object;
+    }
+
+    void erase(const const_iterator& position)
+    {
+        if(isEmpty() || position == cend())
+            throw std::out_of_range("Attempt to erase an item out of scope or the container is empty");
+        if(!owns(position.current))
+            throw std::invalid_argument("Attempt to erase an object which is not in this list");
+        unlinkHook(position.current);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        auto it = firstIncluded;
+        while(it != lastExcluded)
+        {
+            auto erased = it;
+            ++it;
+            erase(erased);
+        }
+    }
+
+    // O(1) unlink by reference
+    void erase(Type& object)
+    {
+        if(!owns(hookOf(object)))
+            throw std::invalid_argument("Attempt to erase an object which is not in this list");
+        unlinkHook(hookOf(object));
+    }
+
+    bool contains(const Type& object) const
+    {
+        return owns(&(object.*Hook));
+    }
+
+    // O(1) iterator to an object of this list
+    iterator iteratorTo(Type& object)
+    {
+        if(!owns(hookOf(object)))
+            throw std::invalid_argument("Object is not in this list");
+        return const_iterator(hookOf(object));
+    }
+
+    iterator begin()
+    {
+        return const_iterator(first);
+    }
+
+    iterator end()
+    {
+        return const_iterator(&sentinel);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(first);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(const_cast<IntrusiveListHook *>(&sentinel));
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type, IntrusiveListHook Type::* Hook>
+class IntrusiveLinkedList<Type, Hook>::ConstIterator
+{
+    friend IntrusiveLinkedList<Type, Hook>;
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename IntrusiveLinkedList::value_type;
+    using difference_type = typename IntrusiveLinkedList::difference_type;
+    using pointer = typename IntrusiveLinkedList::const_pointer;
+    using reference = typename IntrusiveLinkedList::const_reference;
+
+protected:
+    IntrusiveListHook * current;
+
+    ConstIterator(IntrusiveListHook * hook) : current(hook)
+    {
+
+    }
+
+public:
+    explicit ConstIterator() : current(nullptr)
+    {}
+
+    reference operator*() const
+    {
+        if(nextOf(current) == nullptr) // sentinel detected
+            throw std::out_of_range("Attempt to dereference the end() iterator");
+        return *objectOf(current);
+    }
+
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    ConstIterator& operator++()
+    {
+        if(nextOf(current) == nullptr) // sentinel detected
+            throw std::out_of_range("Attempt to increment the end() itertator");
+        current = nextOf(current);
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        auto result = *this;
+        ++(*this);
+        return result;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(prevOf(current) == nullptr) // head detected
+            throw std::out_of_range("Attempt to decrement the begin() iterator");
+        current = prevOf(current);
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        auto result = *this;
+        --(*this);
+        return result;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        auto it = *this;
+        for(difference_type i = 0; i < d; ++i)
+        {
+            if(nextOf(it.current) == nullptr) // sentinel detected
+                throw std::range_error("Attempt to move the iterator beyond end()");
+            it.current = nextOf(it.current);
+        }
+        return it;
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        auto it = *this;
+        for(difference_type i = 0; i < d && prevOf(it.current) != nullptr; ++i)
+            it.current = prevOf(it.current);
+        return it;
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return current == other.current;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return current != other.current;
+    }
+};
+
+template <typename Type, IntrusiveListHook Type::* Hook>
+class IntrusiveLinkedList<Type, Hook>::Iterator : public IntrusiveLinkedList<Type, Hook>::ConstIterator
+{
+    friend IntrusiveLinkedList<Type, Hook>;
+public:
+    using pointer = typename IntrusiveLinkedList::pointer;
+    using reference = typename IntrusiveLinkedList::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other)
+        : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+
+    pointer operator->() const
+    {
+        return &**this;
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_INTRUSIVELINKEDLIST_H
@@ -1,14 +1,32 @@
 #ifndef AISDI_LINEAR_LINKEDLIST_H
 #define AISDI_LINEAR_LINKEDLIST_H
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "AllocationStats.h"
+#include "GenerationalSlots.h"
+#include "HotPathHooks.h"
+#include "IndexableSkipList.h"
+#include "ListLinks.h"
+#include "NodeHandles.h"
+#include "NodePayload.h"
+#include "NodeSlabs.h"
+#include "ValueIndex.h"
 
 namespace aisdi
 {
 
-template <typename Type>
+// Payload is InlinePayload or OutOfLinePayload (see NodePayload.h),
+// Lookup is NoValueIndex or HashValueIndex<> (see ValueIndex.h).
+template <typename Type, typename Payload = InlinePayload, typename Lookup = NoValueIndex>
 class LinkedList
 {
 public:
@@ -25,7 +43,14 @@ public:
     using iterator = Iterator;
     using const_iterator = ConstIterator;
 
+    // Generation-checked reference to an item, see enableHandles(). Unlike an iterator it can be
+    // told stale in O(1) after its item is erased. Only meaningful to the list which issued it.
+    using Handle = detail::GenerationalHandle<LinkedList>;
+
 private:
+    using PayloadHolder = typename Payload::template Holder<Type>;
+
+    // links first: a traversal reads them from the node's first cache line, whatever the item size
     class Node
     {
     public:
@@ -33,20 +58,569 @@ private:
         {
 
         }
-        Node(const value_type &item) :item(item), next(nullptr), prev(nullptr)
+        Node(const value_type &item) :next(nullptr), prev(nullptr), payload(item)
+        {
+
+        }
+        Node(value_type &&item) :next(nullptr), prev(nullptr), payload(std::move(item))
+        {
+
+        }
+        Node(const PayloadHolder &other) :next(nullptr), prev(nullptr), payload(other)
+        {
+
+        }
+        Node(PayloadHolder &&other) :next(nullptr), prev(nullptr), payload(std::move(other))
         {
 
         }
-        value_type item;
+        value_type& item()
+        {
+            return payload.get();
+        }
+        const value_type& item() const
+        {
+            return payload.get();
+        }
         Node * next;
         Node * prev;
+        PayloadHolder payload;
 
     } * first, * last; // for head and tail (sentinel)
     size_type count;
+    using ValueIndex = typename Lookup::template Index<Type, Node>;
+    ValueIndex values; // kept in sync by linkBefore, unlinkNode, replaceNode and adoptNodes
+    IndexableSkipList<Node *> * positionIndex; // optional, nullptr when disabled
+    detail::NodeHandles<Node> * handles; // optional, nullptr when disabled
+    std::uint32_t nextHandleGeneration; // where the next handle table starts, past all handles issued before
+    AllocationStats * allocationStats; // optional, nullptr when disabled
+
+    // Finger: the last node resolved by position and its index, nullptr when unknown.
+    // Positional requests start from the nearest of head, tail and finger. Being a cache
+    // updated from const methods, it makes concurrent positional reads of one list unsafe.
+    mutable Node * fingerNode;
+    mutable size_type fingerIndex;
+
+    // the slabs defragment() placed some of the nodes in, nullptr when none is (see NodeSlabs.h)
+    detail::NodeSlabs * slabs;
+    Node * defragmentCursor; // next node of an incremental defragment() pass, nullptr before a pass
+
+    void unlinkRange(Node * from, Node * to)
+    {
+        detail::unlinkRange(first, from, to);
+    }
+
+    void linkRangeBefore(Node * position, Node * from, Node * to)
+    {
+        detail::linkRangeBefore(first, position, from, to);
+    }
+
+    static size_type countRange(Node * from, Node * lastExcluded)
+    {
+        size_type result = 0;
+        for(; from != lastExcluded; from = from->next)
+        {
+            if(from->next == nullptr) // sentinel detected
+                throw std::out_of_range("Range does not end before end()");
+            ++result;
+        }
+        return result;
+    }
+
+    // index of node if it is the head, the sentinel or the finger; O(1)
+    bool knownIndexOf(Node * node, size_type& index) const
+    {
+        if(node == first)
+            index = 0;
+        else if(node == last)
+            index = count;
+        else if(node == fingerNode)
+            index = fingerIndex;
+        else
+            return false;
+        return true;
+    }
+
+    // walks in both directions at once until the head, the sentinel or the finger is met,
+    // so it costs O(distance to the nearest of them)
+    size_type indexOfNode(Node * node) const
+    {
+        Node * forward = node;
+        Node * backward = node;
+        size_type index;
+        for(size_type steps = 0; ; ++steps)
+        {
+            if(knownIndexOf(forward, index))
+                return index - steps;
+            if(knownIndexOf(backward, index))
+                return index + steps;
+            forward = forward->next;
+            backward = backward->prev;
+        }
+    }
+
+    // 1-based rank of node, the sentinel has rank count + 1; needs positionIndex
+    size_type rankOf(Node * node) const
+    {
+        if(node == last)
+            return count + 1;
+        if(node == first)
+            return 1;
+        size_type steps = 0;
+        for(; !positionIndex->hasTower(node); node = node->next) // towers are ~4 nodes apart
+            ++steps;
+        return positionIndex->rankOf(node) - steps;
+    }
+
+    // As rankOf, as a 0-based index, but false for a node that splice, splitAt or mergeSorted moved
+    // to another list meanwhile: its walk ends at the sentinel of that list instead of at a tower.
+    bool ownedIndexOf(Node * node, size_type& index) const
+    {
+        size_type steps = 0;
+        for(; node != last && node != first && !positionIndex->hasTower(node); node = node->next)
+        {
+            if(node->next == nullptr) // sentinel of another list
+                return false;
+            ++steps;
+        }
+        index = (node == last ? count : node == first ? 0 : positionIndex->rankOf(node) - 1) - steps;
+        return true;
+    }
+
+    // Index of an iterator's node when a positional jump from it can start at this list: through
+    // the positional index, or in O(1) from the head, the sentinel or the finger. Otherwise the jump
+    // walks links, which is also how an iterator whose node was moved to another list jumps.
+    bool indexForJump(Node * node, size_type& index) const
+    {
+        return positionIndex ? ownedIndexOf(node, index) : knownIndexOf(node, index);
+    }
+
+    // node at 0-based index, index == count gives the sentinel
+    Node * nodeAt(size_type index) const
+    {
+        Node * node;
+        size_type steps;
+        if(index == count)
+            return last;
+        if(positionIndex)
+        {
+            auto floor = positionIndex->floor(index + 1);
+            node = floor.second == 0 ? first : floor.first;
+            for(steps = floor.second == 0 ? index : index + 1 - floor.second; steps > 0; --steps)
+                node = node->next;
+            return node;
+        }
+
+        // starts from the nearest of head, sentinel and finger
+        node = first;
+        steps = index;
+        bool forward = true;
+        if(count - index < steps)
+        {
+            node = last;
+            steps = count - index;
+            forward = false;
+        }
+        if(fingerNode)
+        {
+            size_type fingerSteps = fingerIndex < index ? index - fingerIndex : fingerIndex - index;
+            if(fingerSteps < steps)
+            {
+                node = fingerNode;
+                steps = fingerSteps;
+                forward = fingerIndex < index;
+            }
+        }
+        AISDI_LINEAR_HOT_PATH(traversal, "LinkedList", steps);
+        for(; steps > 0; --steps)
+            node = forward ? node->next : node->prev;
+        fingerNode = node;
+        fingerIndex = index;
+        return node;
+    }
+
+    void fingerAfterLink(Node * position)
+    {
+        if(!fingerNode || position == last || position == fingerNode->next)
+            return; // inserted after the finger
+        if(position == first || position == fingerNode)
+            ++fingerIndex; // inserted before the finger
+        else
+            fingerNode = nullptr; // somewhere else, finding out on which side is not O(1)
+    }
+
+    void fingerBeforeUnlink(Node * node)
+    {
+        if(!fingerNode)
+            return;
+        if(node == fingerNode)
+        {
+            if(node->next != last)
+            {
+                fingerNode = node->next;
+            }
+            else if(node != first)
+            {
+                fingerNode = node->prev;
+                --fingerIndex;
+            }
+            else
+            {
+                fingerNode = nullptr;
+            }
+        }
+        else if(node == first || node == fingerNode->prev)
+        {
+            --fingerIndex;
+        }
+        else if(node != last->prev && node != fingerNode->next)
+        {
+            fingerNode = nullptr;
+        }
+    }
+
+    // every new node enters the list here; returns node
+    Node * linkBefore(Node * position, Node * node)
+    {
+        try
+        {
+            if(handles)
+                handles->issue(node);
+            try
+            {
+                values.linked(node->item(), node);
+            }
+            catch(...)
+            {
+                if(handles)
+                    handles->retire(node);
+                throw;
+            }
+        }
+        catch(...)
+        {
+            destroyNode(node);
+            throw;
+        }
+        placeBefore(position, node);
+        return node;
+    }
+
+    // every node leaves the list here, the caller destroys it
+    void unlinkNode(Node * node)
+    {
+        detachNode(node);
+        values.unlinked(node->item(), node);
+        if(handles)
+            handles->retire(node);
+    }
+
+    // links node in front of position, keeping the count, finger and positional index right
+    void placeBefore(Node * position, Node * node)
+    {
+        size_type rank = positionIndex ? rankOf(position) : 0;
+        fingerAfterLink(position);
+        linkRangeBefore(position, node, node);
+        ++count;
+        if(positionIndex)
+            positionIndex->insert(node, rank);
+    }
+
+    // the reverse of placeBefore()
+    void detachNode(Node * node)
+    {
+        size_type rank = positionIndex ? rankOf(node) : 0;
+        fingerBeforeUnlink(node);
+        if(node == defragmentCursor)
+            defragmentCursor = node->next;
+        unlinkRange(node, node);
+        --count;
+        if(positionIndex)
+            positionIndex->erase(node, rank);
+    }
+
+    Handle handleOfNode(Node * node) const
+    {
+        if(!handles)
+            return Handle();
+        std::uint32_t slot = handles->slotOf(node);
+        return Handle(slot, handles->generationOf(slot));
+    }
+
+    // throws unless handle refers to an item of this list
+    Node * nodeOf(const Handle& handle) const
+    {
+        Node * node = handles ? handles->resolve(handle.slot, handle.generation) : nullptr;
+        if(!node)
+            throw std::invalid_argument("Attempt to use a stale handle");
+        return node;
+    }
+
+    // every node holding an item is allocated here
+    template <typename Item>
+    Node * newNode(Item&& item)
+    {
+        Node * node = new Node(std::forward<Item>(item));
+        if(allocationStats)
+            allocationStats->allocated(sizeof(Node));
+        return node;
+    }
+
+    // every node is freed here; only a list with slab nodes looks the node up in its slab table
+    void destroyNode(Node * node)
+    {
+        if(allocationStats)
+            allocationStats->freed(sizeof(Node));
+        if(!slabs)
+        {
+            delete node;
+            return;
+        }
+        node->~Node();
+        if(!slabs->release(node))
+            ::operator delete(node);
+        dropEmptySlabs();
+    }
+
+    void dropEmptySlabs()
+    {
+        if(slabs && slabs->isEmpty())
+        {
+            delete slabs;
+            slabs = nullptr;
+        }
+    }
+
+    // Unlinks node and frees it, handing its item out. The item is moved out once the indexes are done
+    // with it when that cannot throw (or it cannot be copied), else copied before, so that a throwing
+    // copy leaves the list as it was.
+    value_type takeNode(Node * node, std::true_type)
+    {
+        unlinkNode(node);
+        value_type item(std::move(node->item()));
+        destroyNode(node);
+        return item;
+    }
+
+    value_type takeNode(Node * node, std::false_type)
+    {
+        value_type item(node->item());
+        unlinkNode(node);
+        destroyNode(node);
+        return item;
+    }
+
+    value_type takeNode(Node * node)
+    {
+        return takeNode(node, std::integral_constant<bool, std::is_nothrow_move_constructible<Type>::value
+            || !std::is_copy_constructible<Type>::value>());
+    }
+
+    // puts replacement (not linked yet) in the place of node, the finger follows it
+    void replaceNode(Node * node, Node * replacement)
+    {
+        replacement->next = node->next;
+        replacement->prev = node->prev;
+        if(node == first)
+            first = replacement;
+        else
+            node->prev->next = replacement;
+        node->next->prev = replacement;
+        if(node == fingerNode)
+            fingerNode = replacement;
+        values.relocated(replacement->item(), node, replacement);
+        if(handles)
+            handles->relocate(node, replacement);
+    }
+
+    // [from, lastExcluded) of other is about to be relinked into this list: its value index entries
+    // and slab counts move here, its handles go stale and the nodes get handles of this list.
+    // O(moved nodes) with a value index, handles or slab nodes on either side (O(slabs) for the
+    // slab counts when all nodes of other move), nothing otherwise.
+    void adoptNodes(LinkedList& other, Node * from, Node * lastExcluded)
+    {
+        if(&other == this)
+            return;
+        reserveSlabs(other, from, lastExcluded);
+        if(ValueIndex::enabled || handles || other.handles)
+            adoptIndexedNodes(other, from, lastExcluded);
+        adoptSlabs(other, from, lastExcluded);
+    }
+
+    // room for the slab counts of [from, lastExcluded) of other, so that adoptSlabs cannot throw
+    void reserveSlabs(const LinkedList& other, Node * from, Node * lastExcluded)
+    {
+        if(!other.slabs || (!slabs && from == other.first && lastExcluded == other.last))
+            return; // nothing to count, or the whole table of other moves here
+        if(!slabs)
+            slabs = new detail::NodeSlabs();
+        slabs->reserveFor(*other.slabs);
+    }
+
+    void adoptSlabs(LinkedList& other, Node * from, Node * lastExcluded)
+    {
+        if(!other.slabs)
+            return;
+        if(from == other.first && lastExcluded == other.last)
+        {
+            if(slabs)
+                slabs->takeAll(*other.slabs);
+            else
+                std::swap(slabs, other.slabs);
+        }
+        else
+        {
+            for(Node * node = from; node != lastExcluded; node = node->next)
+                slabs->take(*other.slabs, node);
+        }
+        other.dropEmptySlabs();
+        dropEmptySlabs();
+    }
+
+    void adoptIndexedNodes(LinkedList& other, Node * from, Node * lastExcluded)
+    {
+        if(handles)
+            handles->reserve(countRange(from, lastExcluded));
+        Node * node = from;
+        try
+        {
+            for(; ValueIndex::enabled && node != lastExcluded; node = node->next)
+                values.linked(node->item(), node);
+        }
+        catch(...)
+        {
+            for(Node * added = from; added != node; added = added->next)
+                values.unlinked(added->item(), added);
+            throw;
+        }
+        for(node = from; node != lastExcluded; node = node->next)
+        {
+            other.values.unlinked(node->item(), node);
+            if(other.handles)
+                other.handles->retire(node);
+            if(handles)
+                handles->issue(node);
+        }
+    }
+
+    // moved nodes of other were relinked into this list, their bytes now count here
+    void adoptStats(LinkedList& other, size_type moved)
+    {
+        if(&other == this || moved == 0)
+            return;
+        if(allocationStats)
+            allocationStats->adopted(moved * sizeof(Node));
+        if(other.allocationStats)
+            other.allocationStats->released(moved * sizeof(Node));
+    }
+
+    // after bulk relinking (splice, split, merge, sort) the finger is dropped, the index built again in O(n)
+    // and an incremental defragment() pass starts over
+    void bulkRelinked()
+    {
+        fingerNode = nullptr;
+        defragmentCursor = nullptr;
+        rebuildPositionalIndex();
+    }
+
+    void rebuildPositionalIndex()
+    {
+        if(!positionIndex)
+            return;
+        delete positionIndex;
+        positionIndex = new IndexableSkipList<Node *>(last);
+        size_type rank = 1;
+        for(Node * node = first; node != last; node = node->next)
+            positionIndex->insert(node, rank++);
+    }
+
+    // Cuts the first run off a null-terminated chain and returns its head. A strictly descending
+    // run is reversed (which keeps sort stable), so the returned run is always non-descending.
+    template <typename Compare>
+    static Node * takeRun(Node *& rest, Compare& comp)
+    {
+        Node * head = rest;
+        Node * tail = rest;
+        if(tail->next && comp(tail->next->item(), tail->item()))
+        {
+            head = nullptr;
+            do
+            {
+                Node * next = tail->next;
+                tail->next = head;
+                head = tail;
+                tail = next;
+            } while(tail && tail->next && comp(tail->next->item(), tail->item()));
+            // tail is the last node of the descending run, not yet prepended
+            rest = tail->next;
+            tail->next = head;
+            return tail;
+        }
+        while(tail->next && !comp(tail->next->item(), tail->item()))
+            tail = tail->next;
+        rest = tail->next;
+        tail->next = nullptr;
+        return head;
+    }
+
+    // Visits [node, end) with a second pointer distance hops ahead, which prefetches the nodes and
+    // payloads the visit is going to need, so that their cache misses overlap with the work on the current item.
+    // Distance 0 is a plain walk, without the second pointer.
+    template <typename NodePointer, typename Function>
+    static void visitNodes(NodePointer node, NodePointer end, Function& function, size_type distance)
+    {
+        if(distance == 0)
+        {
+            for(; node != end; node = node->next)
+                function(node->item());
+            return;
+        }
+        NodePointer ahead = node;
+        for(size_type i = 0; i < distance && ahead != end; ++i)
+        {
+            ahead = ahead->next;
+            detail::prefetch(ahead);
+        }
+        for(; node != end; node = node->next)
+        {
+            if(ahead != end)
+            {
+                ahead->payload.prefetch();
+                ahead = ahead->next;
+                detail::prefetch(ahead);
+            }
+            function(node->item());
+        }
+    }
+
+    // Appends the merge of two non-descending chains at *tail, tail ends up at the last next field.
+    template <typename Compare>
+    static void mergeRuns(Node **& tail, Node * left, Node * right, Compare& comp)
+    {
+        while(left && right)
+        {
+            if(comp(right->item(), left->item()))
+            {
+                *tail = right;
+                right = right->next;
+            }
+            else
+            {
+                *tail = left;
+                left = left->next;
+            }
+            tail = &(*tail)->next;
+        }
+        *tail = left ? left : right;
+        while(*tail)
+            tail = &(*tail)->next;
+    }
 
 public:
+    static const size_type defaultPrefetchDistance = 4;
 
-    LinkedList()
+    LinkedList() : positionIndex(nullptr), handles(nullptr), nextHandleGeneration(0), allocationStats(nullptr), fingerNode(nullptr), fingerIndex(0),
+        slabs(nullptr), defragmentCursor(nullptr)
     {
         count = 0;
         Node * newNode = new Node();
@@ -54,7 +628,9 @@ public:
         last = newNode;
     }
 
-    LinkedList(std::initializer_list<Type> l)
+    LinkedList(std::initializer_list<Type> l) : positionIndex(nullptr), handles(nullptr), nextHandleGeneration(0), allocationStats(nullptr),
+        fingerNode(nullptr), fingerIndex(0),
+        slabs(nullptr), defragmentCursor(nullptr)
     {
         count = 0;
         Node * newNode = new Node(); // sentinel
@@ -65,8 +641,11 @@ public:
             append(*p);
     }
 
-    LinkedList(const LinkedList& other)
+    LinkedList(const LinkedList& other) : positionIndex(nullptr), handles(nullptr), nextHandleGeneration(0), allocationStats(nullptr),
+        fingerNode(nullptr), fingerIndex(0),
+        slabs(nullptr), defragmentCursor(nullptr)
     {
+        AISDI_LINEAR_HOT_PATH(bulkCopy, "LinkedList", other.count);
         count = 0;
         Node * newNode = new Node();
         first = newNode;
@@ -80,6 +659,21 @@ public:
         first = other.first;
         last = other.last;
         count = other.count;
+        positionIndex = other.positionIndex;
+        handles = other.handles;
+        nextHandleGeneration = other.nextHandleGeneration;
+        allocationStats = other.allocationStats;
+        fingerNode = other.fingerNode;
+        fingerIndex = other.fingerIndex;
+        slabs = other.slabs;
+        defragmentCursor = other.defragmentCursor;
+        values.swap(other.values);
+        other.positionIndex = nullptr;
+        other.handles = nullptr;
+        other.allocationStats = nullptr;
+        other.fingerNode = nullptr;
+        other.slabs = nullptr;
+        other.defragmentCursor = nullptr;
         other.count = 0;
         other.last = nullptr; // makes source useless; maybe sentinel should be intialized?
         other.first = nullptr;
@@ -87,13 +681,17 @@ public:
 
     ~LinkedList()
     {
+        delete positionIndex;
+        delete handles;
         Node * i = last;
         while(i != first)
         {
             i = i->prev;
-            delete i->next;
+            destroyNode(i->next);
         }
-        delete i;
+        destroyNode(i);
+        delete slabs; // an empty table at most, the last slab node took the rest with it
+        delete allocationStats;
     }
 
     LinkedList& operator=(const LinkedList& other)
@@ -101,6 +699,7 @@ public:
         if(first == other.first)
             return *this;
 
+        AISDI_LINEAR_HOT_PATH(bulkCopy, "LinkedList", other.count);
         erase(begin(), end());
         for(auto it = other.begin(); it != other.end(); ++it)
             append(*it);
@@ -115,9 +714,28 @@ public:
 
         erase(begin(),end());
         delete last;
+        delete positionIndex;
+        disableHandles();
+        delete slabs;
+        delete allocationStats; // the stats go with the nodes
         first = other.first;
         last = other.last;
         count = other.count;
+        positionIndex = other.positionIndex;
+        handles = other.handles;
+        nextHandleGeneration = std::max(nextHandleGeneration, other.nextHandleGeneration);
+        allocationStats = other.allocationStats;
+        fingerNode = other.fingerNode;
+        fingerIndex = other.fingerIndex;
+        slabs = other.slabs;
+        defragmentCursor = other.defragmentCursor;
+        values.swap(other.values);
+        other.positionIndex = nullptr;
+        other.handles = nullptr;
+        other.allocationStats = nullptr;
+        other.fingerNode = nullptr;
+        other.slabs = nullptr;
+        other.defragmentCursor = nullptr;
         other.first = nullptr;
         other.last = nullptr;
         other.count = 0;
@@ -135,66 +753,43 @@ public:
         return count;
     }
 
-    void append(const Type& item)
+    // the returned handle is valid only while the list has handles enabled, see enableHandles()
+    Handle append(const Type& item)
     {
-        Node * ptr = new Node(item);
-        if(count == 0)
-        {
-
-            first = ptr;
-            last->prev = ptr;
-            ptr->next = last;
+        return handleOfNode(linkBefore(last, newNode(item)));
+    }
 
-        }
-        else
-        {
-            ptr->prev = last->prev;
-            last->prev->next = ptr;
-            last->prev = ptr;
-            ptr->next = last;
-        }
-        ++count;
+    Handle append(Type&& item)
+    {
+        return handleOfNode(linkBefore(last, newNode(std::move(item))));
     }
 
-    void prepend(const Type& item)
+    Handle prepend(const Type& item)
     {
-        Node * ptr = new Node(item); // node to be added
-        if(count == 0)
-        {
+        return handleOfNode(linkBefore(first, newNode(item)));
+    }
 
-            first = ptr;
-            last->prev = ptr;
-            ptr->next = last;
+    Handle prepend(Type&& item)
+    {
+        return handleOfNode(linkBefore(first, newNode(std::move(item))));
+    }
 
-        }
-        else
-        {
-            ptr -> prev = nullptr;
-            first -> prev = ptr;
-            ptr -> next = first;
-            first = ptr;
-        }
-        ++count;
+    Handle insert(const const_iterator& insertPosition, const Type& item)
+    {
+        return handleOfNode(linkBefore(insertPosition.getNode(), newNode(item)));
     }
 
-    void insert(const const_iterator& insertPosition, const Type& item)
+    Handle insert(const const_iterator& insertPosition, Type&& item)
     {
+        return handleOfNode(linkBefore(insertPosition.getNode(), newNode(std::move(item))));
+    }
 
-        if(isEmpty()) // not sure if it's needed
-            append(item);
-        else if(insertPosition == end())
-            append(item);
-        else if(insertPosition == begin())
-            prepend(item);
-        else
-        {
-            auto inserted = new Node(item); // node to be added
-            insertPosition.getNode() -> prev -> next = inserted;
-            inserted -> prev = insertPosition.getNode() -> prev;
-            insertPosition.getNode() -> prev = inserted;
-            inserted -> next = insertPosition.getNode();
-            ++count;
-        }
+    // O(log n) with the positional index, O(distance to head, tail or finger) without it
+    void insertAt(size_type index, const Type& item)
+    {
+        if(index > count)
+            throw std::out_of_range("Attempt to insert beyond end()");
+        linkBefore(nodeAt(index), newNode(item));
     }
 
     Type popFirst()
@@ -202,11 +797,7 @@ public:
         if(isEmpty())
             throw std::logic_error("Attempt to pop from an empty container");
 
-        Node * ptr = first;
-        value_type returned = ptr->item;
-        erase(begin());
-
-        return returned;
+        return takeNode(first);
     }
 
     Type popLast()
@@ -214,11 +805,7 @@ public:
         if(isEmpty())
             throw std::logic_error("Attempt to pop from an empty container");
 
-        Node * ptr = last -> prev;
-        value_type returned = ptr -> item;
-        erase(--end());
-
-        return returned;
+        return takeNode(last->prev);
     }
 
 
@@ -227,71 +814,483 @@ public:
         if(isEmpty() || position == cend())
             throw std::out_of_range("Attempt to erase an item out of scope or the container is empty");
 
-        if(position == cbegin())
+        Node * erased = position.getNode();
+        unlinkNode(erased);
+        destroyNode(erased);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        AISDI_LINEAR_HOT_PATH(rangeErase, "LinkedList", 0); // counted by the loop, without a walk of its own
+        size_type erasedCount = 0;
+        auto ptr = firstIncluded;
+        while(ptr != lastExcluded)
         {
-            if(getSize() == 1)
+            auto erased = ptr; // temporary for deletion
+            ++ptr;
+            erase(erased);
+            ++erasedCount;
+        }
+        AISDI_LINEAR_HOT_PATH_ELEMENTS(erasedCount);
+    }
+
+    // Moves all nodes of other in front of position, other becomes empty. O(1), nothing is copied.
+    void splice(const const_iterator& position, LinkedList& other)
+    {
+        if(&other == this)
+            throw std::invalid_argument("Attempt to splice a list into itself");
+        if(other.isEmpty())
+            return;
+
+        Node * from = other.first;
+        Node * to = other.last->prev;
+        adoptNodes(other, from, other.last);
+        other.unlinkRange(from, to);
+        linkRangeBefore(position.getNode(), from, to);
+        adoptStats(other, other.count);
+        count += other.count;
+        other.count = 0;
+        bulkRelinked();
+        other.bulkRelinked();
+    }
+
+    // Moves [firstIncluded, lastExcluded) of other in front of position. Relinking is O(1),
+    // keeping both sizes right costs a walk over the moved range (skipped when other is this list).
+    // position must not be inside the moved range.
+    void splice(const const_iterator& position, LinkedList& other,
+                const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(firstIncluded == lastExcluded)
+            return;
+
+        Node * from = firstIncluded.getNode();
+        Node * to = lastExcluded.getNode()->prev;
+        size_type moved = &other == this ? 0 : countRange(from, lastExcluded.getNode());
+        if(from->next == nullptr) // sentinel detected
+            throw std::out_of_range("Attempt to splice a range starting at end()");
+
+        adoptNodes(other, from, lastExcluded.getNode());
+        other.unlinkRange(from, to);
+        linkRangeBefore(position.getNode(), from, to);
+        adoptStats(other, moved);
+        count += moved;
+        other.count -= moved;
+        bulkRelinked();
+        if(&other != this)
+            other.bulkRelinked();
+    }
+
+    // Returns [position, end()) as a new list, this list keeps [begin(), position).
+    // Relinking is O(1), counting the moved nodes O(distance to head, tail or finger).
+    LinkedList splitAt(const const_iterator& position)
+    {
+        LinkedList tail;
+        Node * from = position.getNode();
+        if(from == last)
+            return tail;
+
+        size_type moved = count - indexOfNode(from);
+        Node * to = last->prev;
+        tail.adoptNodes(*this, from, last);
+        unlinkRange(from, to);
+        tail.linkRangeBefore(tail.last, from, to);
+        tail.adoptStats(*this, moved);
+        tail.count = moved;
+        count -= moved;
+        bulkRelinked();
+        return tail;
+    }
+
+    // Merges other into this list, both have to be sorted by comp. Stable: of equal items,
+    // the ones from this list go first. Nodes are relinked, other becomes empty.
+    // As for sort(), comp must not throw: the counts, value indexes and handles of both lists are
+    // moved over before relinking and would not match the links any more.
+    template <typename Compare = std::less<Type>>
+    void mergeSorted(LinkedList& other, Compare comp = Compare())
+    {
+        if(&other == this || other.isEmpty())
+            return;
+
+        adoptNodes(other, other.first, other.last);
+        Node * position = first;
+        while(other.first != other.last)
+        {
+            Node * from = other.first;
+            Node * to = other.last->prev;
+            if(position == last) // the rest of other goes to the end in one go
             {
-                delete first;
-                first = last;
+                other.unlinkRange(from, to);
+                linkRangeBefore(last, from, to);
+                break;
             }
-            else if(getSize() > 1)
+            if(comp(from->item(), position->item()))
+            {
+                // moves the whole run of other that goes before position at once
+                to = from;
+                while(to->next != other.last && comp(to->next->item(), position->item()))
+                    to = to->next;
+                other.unlinkRange(from, to);
+                linkRangeBefore(position, from, to);
+            }
+            else
+            {
+                position = position->next;
+            }
+        }
+        adoptStats(other, other.count);
+        count += other.count;
+        other.count = 0;
+        bulkRelinked();
+        other.bulkRelinked();
+    }
+
+    // Stable bottom-up natural merge sort: relinks nodes, allocates nothing and keeps iterators valid.
+    // Existing ascending and strictly descending runs are used as they are, so sorted input takes one pass.
+    // comp must not throw.
+    template <typename Compare = std::less<Type>>
+    void sort(Compare comp = Compare())
+    {
+        if(count < 2)
+            return;
+
+        last->prev->next = nullptr; // passes work on a null-terminated, singly linked chain
+        Node * head = first;
+        for(size_type runs = 0; runs != 1; )
+        {
+            Node * merged = nullptr;
+            Node ** tail = &merged;
+            Node * rest = head;
+            runs = 0;
+            while(rest)
             {
-                auto toBeErased = first;
-                first = first->next;
-                first->prev = nullptr;
-                delete toBeErased;
+                Node * left = takeRun(rest, comp);
+                Node * right = rest ? takeRun(rest, comp) : nullptr;
+                mergeRuns(tail, left, right, comp);
+                ++runs;
             }
+            head = merged;
         }
-        else if(position == (cend()-1) )
 
+        // restores prev links and the sentinel
+        first = head;
+        head->prev = nullptr;
+        Node * node = head;
+        for(; node->next; node = node->next)
+            node->next->prev = node;
+        node->next = last;
+        last->prev = node;
+        bulkRelinked();
+    }
+
+    // Moves the nodes into one freshly allocated slab in list order, so that traversal walks memory
+    // sequentially again after long insert/erase churn. Items are moved (copied if their move may throw),
+    // the positional index and the finger follow the nodes. Invalidates all iterators except end().
+    void defragment()
+    {
+        defragmentCursor = nullptr;
+        if(count)
+            defragment(count);
+    }
+
+    // Incremental variant: relocates at most maxNodes nodes, continuing where the previous call stopped,
+    // and returns true when the pass has reached end(). Nodes linked in meanwhile before the
+    // continuation point are skipped; splice, splitAt, mergeSorted and sort restart the pass.
+    // Invalidates iterators to the relocated nodes.
+    bool defragment(size_type maxNodes)
+    {
+        if(maxNodes == 0)
+            throw std::invalid_argument("Attempt to defragment zero nodes");
+        if(!defragmentCursor)
+            defragmentCursor = first;
+
+        size_type slabSize = 0;
+        for(Node * node = defragmentCursor; node != last && slabSize < maxNodes; node = node->next)
+            ++slabSize;
+        if(slabSize == 0)
         {
-            auto ptr = last->prev;
-            last->prev = last->prev->prev;
-            last->prev->next = last;
-            delete ptr;
+            defragmentCursor = nullptr;
+            return true;
+        }
+        AISDI_LINEAR_HOT_PATH(reallocation, "LinkedList", slabSize);
 
+        if(!slabs)
+            slabs = new detail::NodeSlabs();
+        Node * slab;
+        try
+        {
+            slab = static_cast<Node *>(slabs->allocate(sizeof(Node), slabSize));
         }
-        else
+        catch(...)
         {
-            Node * erased = position.getNode();
-            erased->prev->next = erased->next;
-            erased->next->prev = erased->prev;
-            delete erased;
+            dropEmptySlabs();
+            throw;
         }
-        --count;
+        if(allocationStats) // one allocation, its nodes are freed one by one
+        {
+            allocationStats->allocated(slabSize * sizeof(Node));
+            ++allocationStats->reallocations;
+        }
+        size_type placed = 0;
+        try
+        {
+            for(; placed < slabSize; ++placed)
+            {
+                Node * node = defragmentCursor;
+                Node * moved = slab + placed;
+                if(positionIndex)
+                    positionIndex->rekey(node, moved);
+                try
+                {
+                    new (moved) Node(std::move_if_noexcept(node->payload));
+                }
+                catch(...)
+                {
+                    if(positionIndex)
+                        positionIndex->rekey(moved, node);
+                    throw;
+                }
+                replaceNode(node, moved);
+                defragmentCursor = moved->next;
+                destroyNode(node);
+            }
+        }
+        catch(...)
+        {
+            for(; placed < slabSize; ++placed) // the slab is freed with its last node
+                slabs->release(slab + placed);
+            dropEmptySlabs();
+            throw;
+        }
+
+        if(defragmentCursor != last)
+            return false;
+        defragmentCursor = nullptr;
+        return true;
     }
 
-    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    // Optional indexable skip list over the nodes: begin() + k, indexOf() and insertAt() become O(log n),
+    // at the price of O(log n) instead of O(1) append/prepend/insert/erase. Iterators stay valid.
+    // splice, splitAt, mergeSorted and sort rebuild the index in O(n). Copies do not inherit it.
+    void enablePositionalIndex()
     {
-        auto ptr = firstIncluded;
-        while(ptr != lastExcluded)
+        if(positionIndex)
+            return;
+        positionIndex = new IndexableSkipList<Node *>(last);
+        rebuildPositionalIndex();
+    }
+
+    void disablePositionalIndex()
+    {
+        delete positionIndex;
+        positionIndex = nullptr;
+    }
+
+    bool hasPositionalIndex() const
+    {
+        return positionIndex != nullptr;
+    }
+
+    // Optional handle table: append, prepend and insert return handles from now on, which erase(handle),
+    // moveToFront(handle) and iteratorTo(handle) resolve in O(1), detecting stale ones. Existing items
+    // get handles in O(n), see handleOf(). A handle goes stale when its item is erased or moved to another
+    // list by splice, splitAt or mergeSorted (which then cost O(moved items)). Copies do not inherit the table.
+    // Handles of a table disabled before stay stale in the new one.
+    void enableHandles()
+    {
+        if(handles)
+            return;
+        handles = new detail::NodeHandles<Node>(nextHandleGeneration);
+        try
         {
-            auto erased = ptr; // temporary for deletion
-            ++ptr;
-            erase(erased);
+            handles->reserve(count);
+        }
+        catch(...)
+        {
+            disableHandles();
+            throw;
         }
+        for(Node * node = first; node != last; node = node->next)
+            handles->issue(node);
+    }
+
+    // all handles go stale, also for tables enabled later; O(handles issued)
+    void disableHandles()
+    {
+        if(!handles)
+            return;
+        nextHandleGeneration = std::max(nextHandleGeneration, handles->getNextGeneration());
+        delete handles;
+        handles = nullptr;
+    }
+
+    bool hasHandles() const
+    {
+        return handles != nullptr;
+    }
+
+    // a handle to the item at position; needs handles enabled
+    Handle handleOf(const const_iterator& position) const
+    {
+        if(!handles)
+            throw std::logic_error("Attempt to take a handle while handles are disabled");
+        if(position.getNode() == last)
+            throw std::out_of_range("Attempt to take a handle to end()");
+        return handleOfNode(position.getNode());
+    }
+
+    // false for stale handles and for all handles while handles are disabled; O(1)
+    bool isValid(const Handle& handle) const
+    {
+        return handles && handles->resolve(handle.slot, handle.generation);
+    }
+
+    // throws std::invalid_argument for a stale handle, as do erase(handle) and moveToFront(handle)
+    iterator iteratorTo(const Handle& handle)
+    {
+        return const_iterator(nodeOf(handle), this);
+    }
+
+    const_iterator iteratorTo(const Handle& handle) const
+    {
+        return const_iterator(nodeOf(handle), this);
+    }
+
+    // O(1), O(log n) with the positional index
+    void erase(const Handle& handle)
+    {
+        Node * erased = nodeOf(handle);
+        unlinkNode(erased);
+        destroyNode(erased);
+    }
+
+    // relinks the item to the front; its handles and iterators stay valid. O(1), O(log n) with the positional index
+    void moveToFront(const Handle& handle)
+    {
+        Node * node = nodeOf(handle);
+        if(node == first)
+            return;
+        detachNode(node);
+        placeBefore(first, node);
+    }
+
+    // true with Lookup = HashValueIndex<>
+    bool hasValueIndex() const
+    {
+        return ValueIndex::enabled;
+    }
+
+    // With Lookup = HashValueIndex<>: an iterator to an item equal to value, end() if there is none.
+    // Expected O(1); of equal items, any one may be found.
+    iterator find(const Type& value)
+    {
+        static_assert(ValueIndex::enabled, "find() needs a LinkedList with a value index");
+        Node * node = values.find(value);
+        return const_iterator(node ? node : last, this);
+    }
+
+    const_iterator find(const Type& value) const
+    {
+        static_assert(ValueIndex::enabled, "find() needs a LinkedList with a value index");
+        Node * node = values.find(value);
+        return const_iterator(node ? node : last, this);
+    }
+
+    bool contains(const Type& value) const
+    {
+        static_assert(ValueIndex::enabled, "contains() needs a LinkedList with a value index");
+        return values.find(value) != nullptr;
+    }
+
+    // erases one item equal to value, returns false if there is none; expected O(1)
+    bool eraseValue(const Type& value)
+    {
+        static_assert(ValueIndex::enabled, "eraseValue() needs a LinkedList with a value index");
+        Node * node = values.find(value);
+        if(!node)
+            return false;
+        unlinkNode(node);
+        destroyNode(node);
+        return true;
+    }
+
+    // bytes held by the value index, 0 without one
+    size_type getValueIndexMemoryUsage() const
+    {
+        return values.getMemoryUsage();
+    }
+
+    // Opt-in accounting of the nodes of this list from now on; the present nodes (sentinel included)
+    // count as live. Spliced nodes move their bytes between the lists without an allocation, a
+    // defragment() slab is one allocation and a reallocation. The optional indexes are not counted.
+    // A move takes the stats along with the nodes, a copy does not inherit them.
+    void enableAllocationStats()
+    {
+        if(allocationStats)
+            return;
+        allocationStats = new AllocationStats();
+        allocationStats->adopted((count + 1) * sizeof(Node));
+    }
+
+    void disableAllocationStats()
+    {
+        delete allocationStats;
+        allocationStats = nullptr;
+    }
+
+    bool hasAllocationStats() const
+    {
+        return allocationStats != nullptr;
+    }
+
+    // all zero while disabled
+    AllocationStats stats() const
+    {
+        return allocationStats ? *allocationStats : AllocationStats();
+    }
+
+    // O(log n) with the positional index, O(distance to head, tail or finger) without it
+    size_type indexOf(const const_iterator& position) const
+    {
+        Node * node = position.getNode();
+        return positionIndex ? rankOf(node) - 1 : indexOfNode(node);
     }
 
 
+    // Calls function(item) for every item in order, prefetching prefetchDistance nodes ahead
+    // (0 turns prefetching off). function must not link or unlink nodes of this list.
+    // Items are passed as const with a value index, as iterators give them.
+    template <typename Function>
+    void forEach(Function function, size_type prefetchDistance = defaultPrefetchDistance)
+    {
+        using NodePointer = typename std::conditional<ValueIndex::enabled, const Node *, Node *>::type;
+        visitNodes<NodePointer>(first, last, function, prefetchDistance);
+    }
+
+    template <typename Function>
+    void forEach(Function function, size_type prefetchDistance = defaultPrefetchDistance) const
+    {
+        visitNodes<const Node *>(first, last, function, prefetchDistance);
+    }
+
     iterator begin()
     {
-        return iterator(first);
+        return const_iterator(first, this);
     }
 
     iterator end()
     {
-        return iterator(last);
+        return const_iterator(last, this);
 
     }
 
     const_iterator cbegin() const
     {
-        return const_iterator(first);
+        return const_iterator(first, this);
     }
 
     const_iterator cend() const
     {
-        return const_iterator(last);
+        return const_iterator(last, this);
     }
 
     const_iterator begin() const
@@ -306,10 +1305,10 @@ public:
 
 };
 
-template <typename Type>
-class LinkedList<Type>::ConstIterator
+template <typename Type, typename Payload, typename Lookup>
+class LinkedList<Type, Payload, Lookup>::ConstIterator
 {
-    friend LinkedList<Type>;
+    friend LinkedList<Type, Payload, Lookup>;
 public:
     using iterator_category = std::bidirectional_iterator_tag;
     using value_type = typename LinkedList::value_type;
@@ -319,11 +1318,12 @@ public:
 
 protected:
     Node* current;
+    const LinkedList* owner; // for positional jumps, has to outlive the iterator even if the node moves on
     Node* getNode() const // should it be public or friend declatarion is needed?
     {
         return current;
     }
-    ConstIterator(Node* node):current(node)
+    ConstIterator(Node* node, const LinkedList* list):current(node), owner(list)
     {
 
     }
@@ -335,7 +1335,7 @@ public:
     {
         if(current->next == nullptr) // sentinel detected
             throw std::out_of_range("Attempt to dereference the end() iterator");
-        return current->item;
+        return current->item();
     }
 
     ConstIterator& operator++()
@@ -370,6 +1370,15 @@ public:
 
     ConstIterator operator+(difference_type d) const
     {
+        size_type index;
+        if(d > 0 && owner->indexForJump(current, index))
+        {
+            size_type target = index + d;
+            if(target > owner->count)
+                throw std::range_error("Attempt to move the iterator beyond end()");
+            return ConstIterator(owner->nodeAt(target), owner);
+        }
+        AISDI_LINEAR_HOT_PATH(traversal, "LinkedList", static_cast<size_type>(d > 0 ? d : 0));
         auto it = *this;
         for(difference_type i = 0; i < d; ++i)
         {
@@ -382,6 +1391,12 @@ public:
 
     ConstIterator operator-(difference_type d) const
     {
+        size_type index;
+        if(d > 0 && owner->indexForJump(current, index))
+        {
+            return ConstIterator(owner->nodeAt(index > size_type(d) ? index - d : 0), owner);
+        }
+        AISDI_LINEAR_HOT_PATH(traversal, "LinkedList", static_cast<size_type>(d > 0 ? d : 0));
         auto it = *this;
         for(difference_type i = 0; i < d; ++i)
         {
@@ -404,13 +1419,16 @@ public:
     }
 };
 
-template <typename Type>
-class LinkedList<Type>::Iterator : public LinkedList<Type>::ConstIterator
+template <typename Type, typename Payload, typename Lookup>
+class LinkedList<Type, Payload, Lookup>::Iterator : public LinkedList<Type, Payload, Lookup>::ConstIterator
 {
-    friend LinkedList<Type>;
+    friend LinkedList<Type, Payload, Lookup>;
 public:
-    using pointer = typename LinkedList::pointer;
-    using reference = typename LinkedList::reference;
+    // items are keys of a value index, which would not notice them changed in place: const, as in std::set
+    using pointer = typename std::conditional<ValueIndex::enabled, typename LinkedList::const_pointer,
+                                              typename LinkedList::pointer>::type;
+    using reference = typename std::conditional<ValueIndex::enabled, typename LinkedList::const_reference,
+                                                typename LinkedList::reference>::type;
 
     explicit Iterator()
     {}
@@ -0,0 +1,52 @@
+#ifndef AISDI_LINEAR_LISTLINKS_H
+#define AISDI_LINEAR_LISTLINKS_H
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// Link manipulation shared by the doubly linked lists. The layout is the one of LinkedList:
+// the head's prev is nullptr, the list ends with a sentinel whose next is nullptr,
+// and first points to the sentinel when the list is empty.
+
+// detaches the chain [from, to] (both included); to must not be the sentinel
+template <typename Link>
+void unlinkRange(Link *& first, Link * from, Link * to)
+{
+    if(from == first)
+    {
+        first = to->next;
+        first->prev = nullptr;
+    }
+    else
+    {
+        from->prev->next = to->next;
+        to->next->prev = from->prev;
+    }
+}
+
+// links a detached chain [from, to] in front of position
+template <typename Link>
+void linkRangeBefore(Link *& first, Link * position, Link * from, Link * to)
+{
+    to->next = position;
+    if(position == first)
+    {
+        from->prev = nullptr;
+        first = from;
+    }
+    else
+    {
+        from->prev = position->prev;
+        position->prev->next = from;
+    }
+    position->prev = to;
+}
+
+} // namespace detail
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_LISTLINKS_H
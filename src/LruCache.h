@@ -0,0 +1,210 @@
+#ifndef AISDI_LINEAR_LRUCACHE_H
+#define AISDI_LINEAR_LRUCACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+#include "HashIndex.h"
+#include "LinkedList.h"
+
+namespace aisdi
+{
+
+// Least recently used cache: entries are kept in a LinkedList from the most to the least recently
+// used one, a HashIndex maps keys to their nodes. A hit relinks its node to the front, an insertion
+// evicts from the back until the entries fit. Every entry has a cost, 1 when the capacity is
+// a number of entries, entrySize(key, value) when it is a number of bytes.
+// Key and Value have to be default constructible (the list sentinel holds an entry).
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class LruCache
+{
+public:
+    using size_type = std::size_t;
+    using key_type = Key;
+    using mapped_type = Value;
+    using SizeFunction = std::function<size_type(const Key&, const Value&)>;
+
+    static const size_type batchPrefetchDistance = 8;
+
+private:
+    struct Entry
+    {
+        Key key;
+        Value value;
+        size_type cost;
+    };
+    using List = LinkedList<Entry>;
+    using Handle = typename List::iterator;
+
+    List entries; // most recently used first
+    HashIndex<Key, Handle, Hash, KeyEqual> index;
+    SizeFunction entrySize; // empty when the capacity counts entries
+    size_type capacity;
+    size_type usage;
+
+    size_type costOf(const Key& key, const Value& value) const
+    {
+        return entrySize ? entrySize(key, value) : 1;
+    }
+
+    // O(1): a single node range spliced within the list is only relinked
+    void touch(const Handle& handle)
+    {
+        if(handle == entries.begin())
+            return;
+        Handle next = handle;
+        ++next;
+        entries.splice(entries.begin(), entries, handle, next);
+    }
+
+    void evictWhileOverCapacity()
+    {
+        while(usage > capacity)
+        {
+            Handle victim = --entries.end();
+            index.erase((*victim).key);
+            usage -= (*victim).cost;
+            entries.erase(victim);
+        }
+    }
+
+public:
+    // capacity in entries
+    explicit LruCache(size_type maxEntries)
+        : index(maxEntries), capacity(maxEntries), usage(0)
+    {
+        if(maxEntries == 0)
+            throw std::invalid_argument("Cache capacity has to be positive");
+    }
+
+    // capacity in bytes, as measured by entrySize for every entry
+    LruCache(size_type maxBytes, SizeFunction sizeOfEntry)
+        : entrySize(sizeOfEntry), capacity(maxBytes), usage(0)
+    {
+        if(maxBytes == 0)
+            throw std::invalid_argument("Cache capacity has to be positive");
+        if(!entrySize)
+            throw std::invalid_argument("Byte capacity needs an entry size function");
+    }
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    bool isEmpty() const
+    {
+        return entries.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return entries.getSize();
+    }
+
+    // in entries or bytes, as given at construction
+    size_type getCapacity() const
+    {
+        return capacity;
+    }
+
+    // sum of the entry costs, never above getCapacity()
+    size_type getUsage() const
+    {
+        return usage;
+    }
+
+    // does not count as a use
+    bool contains(const Key& key) const
+    {
+        return index.contains(key);
+    }
+
+    // nullptr on a miss; a hit becomes the most recently used entry.
+    // The pointer is valid until the entry is evicted or erased.
+    Value * get(const Key& key)
+    {
+        Handle * handle = index.find(key);
+        if(!handle)
+            return nullptr;
+        Handle found = *handle;
+        touch(found);
+        return &(*found).value;
+    }
+
+    // Looks up count keys as get() would, in order, storing the results in values.
+    // The index slots of the keys ahead are prefetched while the current one is resolved,
+    // so the cache misses of independent lookups overlap. Returns the number of hits.
+    size_type getMany(const Key * keys, size_type count, Value ** values)
+    {
+        size_type hits = 0;
+        for(size_type i = 0; i < count && i < batchPrefetchDistance; ++i)
+            index.prefetch(keys[i]);
+        for(size_type i = 0; i < count; ++i)
+        {
+            if(i + batchPrefetchDistance < count)
+                index.prefetch(keys[i + batchPrefetchDistance]);
+            values[i] = get(keys[i]);
+            if(values[i])
+                ++hits;
+        }
+        return hits;
+    }
+
+    // Inserts or replaces the entry of key, which becomes the most recently used one,
+    // then evicts the least recently used entries until the cache is within its capacity.
+    void put(const Key& key, const Value& value)
+    {
+        size_type cost = costOf(key, value);
+        if(cost > capacity)
+            throw std::length_error("Entry does not fit in the cache");
+
+        Handle * handle = index.find(key);
+        if(handle)
+        {
+            Handle found = *handle;
+            (*found).value = value;
+            usage = usage - (*found).cost + cost;
+            (*found).cost = cost;
+            touch(found);
+        }
+        else
+        {
+            entries.prepend(Entry { key, value, cost });
+            try
+            {
+                index.insert(key, entries.begin());
+            }
+            catch(...)
+            {
+                entries.erase(entries.begin());
+                throw;
+            }
+            usage += cost;
+        }
+        evictWhileOverCapacity();
+    }
+
+    // returns false when key is not cached
+    bool erase(const Key& key)
+    {
+        Handle * handle = index.find(key);
+        if(!handle)
+            return false;
+        Handle found = *handle;
+        index.erase(key);
+        usage -= (*found).cost;
+        entries.erase(found);
+        return true;
+    }
+
+    void clear()
+    {
+        index.clear();
+        entries.erase(entries.begin(), entries.end());
+        usage = 0;
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_LRUCACHE_H
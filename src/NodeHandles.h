@@ -0,0 +1,104 @@
+#ifndef AISDI_LINEAR_NODEHANDLES_H
+#define AISDI_LINEAR_NODEHANDLES_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "GenerationalSlots.h"
+#include "HashIndex.h"
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// Generational slots referring to list nodes (see LinkedList::enableHandles()), a retired node's
+// slot is reused with its generation bumped. The slot of every node is kept here too, so that
+// nodes of lists without handles carry nothing.
+template <typename Node>
+class NodeHandles
+{
+public:
+    using size_type = std::size_t;
+
+    explicit NodeHandles(std::uint32_t firstGeneration = 0) : slots(firstGeneration)
+    {
+
+    }
+
+    size_type getSize() const
+    {
+        return slots.getSize();
+    }
+
+    // makes the next count issue() calls nothrow
+    void reserve(size_type count)
+    {
+        slots.reserve(count);
+        slotOfNode.reserve(slots.getSize() + count);
+    }
+
+    // the slot now referring to node
+    std::uint32_t issue(Node * node)
+    {
+        slots.reserve(1);
+        slotOfNode.reserve(slots.getSize() + 1);
+        std::uint32_t slot = slots.acquire(node);
+        slotOfNode.insert(node, slot);
+        return slot;
+    }
+
+    void retire(Node * node)
+    {
+        std::uint32_t slot = slotOf(node);
+        slotOfNode.erase(node);
+        slots.release(slot);
+    }
+
+    // the node moved to another address, its handles stay valid
+    void relocate(Node * from, Node * to)
+    {
+        std::uint32_t slot = slotOf(from);
+        slotOfNode.erase(from); // makes room for to, inserting cannot rehash
+        slotOfNode.insert(to, slot);
+        slots[slot] = to;
+    }
+
+    // node has to hold a slot
+    std::uint32_t slotOf(Node * node) const
+    {
+        return *slotOfNode.find(node);
+    }
+
+    std::uint32_t generationOf(std::uint32_t slot) const
+    {
+        return slots.generationOf(slot);
+    }
+
+    // nullptr unless slot still refers to the node it referred to in generation
+    Node * resolve(std::uint32_t slot, std::uint32_t generation) const
+    {
+        return slots.isCurrent(slot, generation) ? slots[slot] : nullptr;
+    }
+
+    std::uint32_t getNextGeneration() const
+    {
+        return slots.getNextGeneration();
+    }
+
+    size_type getMemoryUsage() const
+    {
+        return slots.getMemoryUsage() + slotOfNode.getMemoryUsage();
+    }
+
+private:
+    GenerationalSlots<Node *> slots;
+    HashIndex<Node *, std::uint32_t> slotOfNode;
+};
+
+} // namespace detail
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_NODEHANDLES_H
@@ -0,0 +1,127 @@
+#ifndef AISDI_LINEAR_NODEPAYLOAD_H
+#define AISDI_LINEAR_NODEPAYLOAD_H
+
+#include <utility>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// hint only, compiled out where the builtin is missing
+inline void prefetch(const void * address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+} // namespace detail
+
+// Payload policies decide how a list node holds its item. Nodes keep their links first,
+// so walking the list touches the first cache line of every node and nothing more.
+
+// The item is a member of the node: one allocation per node, best for small items.
+struct InlinePayload
+{
+    template <typename Type>
+    class Holder
+    {
+    public:
+        Holder() : value()
+        {
+
+        }
+
+        explicit Holder(const Type& item) : value(item)
+        {
+
+        }
+
+        explicit Holder(Type&& item) : value(std::move(item))
+        {
+
+        }
+
+        Type& get()
+        {
+            return value;
+        }
+
+        const Type& get() const
+        {
+            return value;
+        }
+
+        void prefetch() const
+        {
+            detail::prefetch(&value);
+        }
+
+    private:
+        Type value;
+    };
+};
+
+// The item lives in its own allocation and the node holds a pointer to it, so nodes stay small
+// whatever the item size and the sentinel holds no item at all. Relocating a node moves the pointer only.
+struct OutOfLinePayload
+{
+    template <typename Type>
+    class Holder
+    {
+    public:
+        Holder() : value(nullptr)
+        {
+
+        }
+
+        explicit Holder(const Type& item) : value(new Type(item))
+        {
+
+        }
+
+        explicit Holder(Type&& item) : value(new Type(std::move(item)))
+        {
+
+        }
+
+        Holder(Holder&& other) noexcept : value(other.value)
+        {
+            other.value = nullptr;
+        }
+
+        Holder(const Holder&) = delete;
+        Holder& operator=(const Holder&) = delete;
+
+        ~Holder()
+        {
+            delete value;
+        }
+
+        Type& get()
+        {
+            return *value;
+        }
+
+        const Type& get() const
+        {
+            return *value;
+        }
+
+        void prefetch() const
+        {
+            detail::prefetch(value);
+        }
+
+    private:
+        Type * value;
+    };
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_NODEPAYLOAD_H
@@ -0,0 +1,177 @@
+#ifndef AISDI_LINEAR_NODESLABS_H
+#define AISDI_LINEAR_NODESLABS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <vector>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// Blocks holding many list nodes at once (see LinkedList::defragment()). Through splice, the nodes
+// of one slab may end up in several lists, so every list with slab nodes keeps a table of the slabs
+// they are in and of how many each slab holds. Freeing a node looks up the table of its own list,
+// without locks; a slab is freed once no table counts nodes in it any more. Until then, a single
+// surviving node keeps its whole slab allocated (defragmenting its list again moves it out).
+class NodeSlabs
+{
+public:
+    NodeSlabs()
+    {
+
+    }
+
+    NodeSlabs(const NodeSlabs&) = delete;
+    NodeSlabs& operator=(const NodeSlabs&) = delete;
+
+    ~NodeSlabs()
+    {
+        for(const Entry& entry : entries)
+            letGo(entry.slab);
+    }
+
+    bool isEmpty() const
+    {
+        return entries.empty();
+    }
+
+    // raw memory for nodeCount nodes counted here, each of them has to be released exactly once,
+    // by this table or by the one it was taken to
+    void * allocate(std::size_t nodeSize, std::size_t nodeCount)
+    {
+        Slab * slab = new Slab(nodeSize * nodeCount);
+        try
+        {
+            entries.insert(upperBound(slab->begin), Entry { slab->begin, slab->end, slab, nodeCount });
+        }
+        catch(...)
+        {
+            delete slab;
+            throw;
+        }
+        return slab->begin;
+    }
+
+    // returns false when node is not in a slab of this table, its memory is not touched then
+    bool release(const void * node)
+    {
+        auto entry = find(node);
+        if(entry == entries.end())
+            return false;
+        if(--entry->nodes == 0)
+        {
+            letGo(entry->slab);
+            entries.erase(entry);
+        }
+        return true;
+    }
+
+    // makes room for taking nodes from other, so that take() and takeAll() do not throw
+    void reserveFor(const NodeSlabs& other)
+    {
+        entries.reserve(entries.size() + other.entries.size());
+    }
+
+    // node moves from a list counted by other to the list of this table
+    void take(NodeSlabs& other, const void * node)
+    {
+        auto from = other.find(node);
+        if(from == other.entries.end())
+            return;
+        ++hold(*from).nodes;
+        if(--from->nodes == 0)
+        {
+            letGo(from->slab);
+            other.entries.erase(from);
+        }
+    }
+
+    // all nodes counted by other move to the list of this table
+    void takeAll(NodeSlabs& other)
+    {
+        for(const Entry& entry : other.entries)
+        {
+            hold(entry).nodes += entry.nodes;
+            letGo(entry.slab);
+        }
+        other.entries.clear();
+    }
+
+private:
+    struct Slab
+    {
+        explicit Slab(std::size_t bytes)
+            : begin(static_cast<char *>(::operator new(bytes))), end(begin + bytes), holders(1)
+        {
+
+        }
+
+        ~Slab()
+        {
+            ::operator delete(begin);
+        }
+
+        Slab(const Slab&) = delete;
+        Slab& operator=(const Slab&) = delete;
+
+        char * const begin;
+        char * const end;
+        std::atomic<std::size_t> holders; // tables counting nodes in it, of lists possibly on other threads
+    };
+
+    struct Entry
+    {
+        const char * begin; // of the slab, copied here so that lookups stay in the table
+        const char * end;
+        Slab * slab;
+        std::size_t nodes; // of this table's list
+    };
+
+    std::vector<Entry> entries; // by begin
+
+    static void letGo(Slab * slab)
+    {
+        if(slab->holders.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete slab;
+    }
+
+    std::vector<Entry>::iterator upperBound(const char * address)
+    {
+        return std::upper_bound(entries.begin(), entries.end(), address, [](const char * value, const Entry& entry)
+        {
+            return std::less<const char *>()(value, entry.begin);
+        });
+    }
+
+    std::vector<Entry>::iterator find(const void * node)
+    {
+        const char * address = static_cast<const char *>(node);
+        auto found = upperBound(address);
+        if(found == entries.begin())
+            return entries.end();
+        --found;
+        return std::less<const char *>()(address, found->end) ? found : entries.end();
+    }
+
+    // the entry of other's slab in this table, added with no nodes if missing (in reserved room)
+    Entry& hold(const Entry& other)
+    {
+        auto position = upperBound(other.begin);
+        if(position != entries.begin() && (position - 1)->slab == other.slab)
+            return *(position - 1);
+        other.slab->holders.fetch_add(1, std::memory_order_relaxed);
+        return *entries.insert(position, Entry { other.begin, other.end, other.slab, 0 });
+    }
+};
+
+} // namespace detail
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_NODESLABS_H
@@ -0,0 +1,203 @@
+#ifndef AISDI_LINEAR_PARALLELSORT_H
+#define AISDI_LINEAR_PARALLELSORT_H
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "LinkedList.h"
+#include "ThreadPool.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+const std::size_t insertionSortThreshold = 32;
+const std::size_t parallelSortThreshold = 8192; // below it spawning costs more than it saves
+
+template <typename Type, typename Compare>
+void insertionSort(Type * data, std::size_t size, Compare& comp)
+{
+    for(std::size_t i = 1; i < size; ++i)
+    {
+        Type item = std::move(data[i]);
+        std::size_t j = i;
+        for(; j > 0 && comp(item, data[j - 1]); --j)
+        {
+            data[j] = std::move(data[j - 1]);
+        }
+        data[j] = std::move(item);
+    }
+}
+
+// stable: on ties the element from the left half goes first
+template <typename Type, typename Compare>
+void mergeHalves(Type * data, Type * buffer, std::size_t middle, std::size_t size, Compare& comp)
+{
+    std::size_t left = 0, right = middle, out = 0;
+    while(left < middle && right < size)
+    {
+        if(comp(data[right], data[left]))
+            buffer[out++] = std::move(data[right++]);
+        else
+            buffer[out++] = std::move(data[left++]);
+    }
+    while(left < middle)
+        buffer[out++] = std::move(data[left++]);
+    while(right < size)
+        buffer[out++] = std::move(data[right++]);
+    for(std::size_t i = 0; i < size; ++i)
+        data[i] = std::move(buffer[i]);
+}
+
+template <typename Type, typename Compare>
+void mergeSort(Type * data, Type * buffer, std::size_t size, Compare& comp)
+{
+    if(size <= insertionSortThreshold)
+    {
+        insertionSort(data, size, comp);
+        return;
+    }
+    std::size_t middle = size / 2;
+    mergeSort(data, buffer, middle, comp);
+    mergeSort(data + middle, buffer + middle, size - middle, comp);
+    mergeHalves(data, buffer, middle, size, comp);
+}
+
+template <typename Type, typename Compare>
+void parallelMergeSort(ThreadPool& pool, Type * data, Type * buffer, std::size_t size, Compare& comp)
+{
+    if(size <= parallelSortThreshold)
+    {
+        mergeSort(data, buffer, size, comp);
+        return;
+    }
+    std::size_t middle = size / 2;
+    ThreadPool::TaskGroup group;
+    pool.spawn(group, [&pool, data, buffer, middle, &comp]
+    {
+        parallelMergeSort(pool, data, buffer, middle, comp);
+    });
+    try
+    {
+        parallelMergeSort(pool, data + middle, buffer + middle, size - middle, comp);
+    }
+    catch(...)
+    {
+        try { pool.wait(group); } catch(...) {} // the spawned half still refers to this frame
+        throw;
+    }
+    pool.wait(group);
+    mergeHalves(data, buffer, middle, size, comp);
+}
+
+} // namespace detail
+
+// Stable merge sort of the vector's storage, halves are sorted as tasks on the pool.
+// comp is shared by all tasks, so it has to be safe to call concurrently.
+template <typename Type, typename Compare = std::less<Type>>
+void parallelMergeSort(Vector<Type>& vector, ThreadPool& pool, Compare comp = Compare())
+{
+    std::size_t size = vector.getSize();
+    if(size < 2)
+        return;
+
+    Type * data = &*vector.begin(); // Vector keeps its items contiguously
+    Type * buffer = new Type [size];
+    try
+    {
+        detail::parallelMergeSort(pool, data, buffer, size, comp);
+    }
+    catch(...)
+    {
+        delete [] buffer;
+        throw;
+    }
+    delete [] buffer;
+}
+
+// Splits the list into one sublist per thread, sorts them with LinkedList::sort as tasks on the pool
+// and merges neighbouring sublists pairwise, also as tasks. Nodes are only relinked, never copied.
+// As for LinkedList::sort, comp must not throw; if spawning a task does, all nodes are given back.
+// A list with handles or a value index is sorted by LinkedList::sort on the calling thread instead:
+// moving its nodes through the sublists would make every handle stale and rebuild the index each time.
+// Either way iterators stay valid.
+template <typename Type, typename Payload, typename Lookup, typename Compare = std::less<Type>>
+void parallelMergeSort(LinkedList<Type, Payload, Lookup>& list, ThreadPool& pool, Compare comp = Compare())
+{
+    std::size_t size = list.getSize();
+    std::size_t partCount = pool.getThreadCount();
+    if(partCount > size / detail::parallelSortThreshold)
+        partCount = size / detail::parallelSortThreshold;
+    if(partCount < 2 || list.hasHandles() || list.hasValueIndex())
+    {
+        list.sort(comp);
+        return;
+    }
+
+    // parts[0] holds the front of the list, stability relies on merging left part with right part
+    auto parts = new LinkedList<Type, Payload, Lookup> [partCount];
+    std::size_t partSize = size / partCount;
+    for(std::size_t i = partCount - 1; i > 0; --i)
+    {
+        auto tail = list.splitAt(list.end() - partSize);
+        parts[i].splice(parts[i].end(), tail);
+    }
+    parts[0].splice(parts[0].end(), list);
+
+    try
+    {
+        ThreadPool::TaskGroup sorting;
+        try
+        {
+            for(std::size_t i = 0; i < partCount; ++i)
+            {
+                LinkedList<Type, Payload, Lookup> * part = &parts[i];
+                pool.spawn(sorting, [part, &comp] { part->sort(comp); });
+            }
+        }
+        catch(...)
+        {
+            try { pool.wait(sorting); } catch(...) {} // tasks spawned so far still use the parts
+            throw;
+        }
+        pool.wait(sorting);
+
+        for(std::size_t step = 1; step < partCount; step *= 2)
+        {
+            ThreadPool::TaskGroup merging;
+            try
+            {
+                for(std::size_t i = 0; i + step < partCount; i += 2 * step)
+                {
+                    LinkedList<Type, Payload, Lookup> * left = &parts[i];
+                    LinkedList<Type, Payload, Lookup> * right = &parts[i + step];
+                    pool.spawn(merging, [left, right, &comp] { left->mergeSorted(*right, comp); });
+                }
+            }
+            catch(...)
+            {
+                try { pool.wait(merging); } catch(...) {}
+                throw;
+            }
+            pool.wait(merging);
+        }
+    }
+    catch(...) // no task is running any more, every group was waited for
+    {
+        for(std::size_t i = 0; i < partCount; ++i) // gives all nodes back, order is unspecified
+            list.splice(list.end(), parts[i]);
+        delete [] parts;
+        throw;
+    }
+
+    list.splice(list.end(), parts[0]);
+    delete [] parts;
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PARALLELSORT_H
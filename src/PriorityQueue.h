@@ -0,0 +1,219 @@
+#ifndef AISDI_LINEAR_PRIORITYQUEUE_H
+#define AISDI_LINEAR_PRIORITYQUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "GenerationalSlots.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Addressable d-ary heap stored in a Vector. top() is an item no other item compares less than
+// (a min-heap for std::less, unlike std::priority_queue). Every item has a slot giving its heap
+// position, so the handle returned by push() finds it for decreaseKey() in O(1); slots are reused
+// with a bumped generation, stale handles are detected. A wider Arity makes the heap shallower at
+// the price of more comparisons per level: with 4-byte items, 8 or 16 children share a cache line.
+// Type has to be default constructible.
+template <typename Type, typename Compare = std::less<Type>, std::size_t Arity = 4>
+class PriorityQueue
+{
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_reference = const Type&;
+
+    using Handle = detail::GenerationalHandle<PriorityQueue>;
+
+private:
+    static const std::uint32_t none = detail::GenerationalSlots<std::uint32_t>::none;
+
+    Vector<Type> items; // the heap
+    Vector<std::uint32_t> slotOf; // parallel to items
+    detail::GenerationalSlots<std::uint32_t> slots; // the heap position of every item
+    Compare comp;
+
+    // puts item with its slot at position, which has to be a hole
+    void place(size_type position, Type&& item, std::uint32_t slot)
+    {
+        items[position] = std::move(item);
+        slotOf[position] = slot;
+        slots[slot] = static_cast<std::uint32_t>(position);
+    }
+
+    // moves the item at position up while it goes before its parent, moving the hole instead of swapping
+    void siftUp(size_type position)
+    {
+        Type item = std::move(items[position]);
+        std::uint32_t slot = slotOf[position];
+        while(position > 0)
+        {
+            size_type parent = (position - 1) / Arity;
+            if(!comp(item, items[parent]))
+                break;
+            place(position, std::move(items[parent]), slotOf[parent]);
+            position = parent;
+        }
+        place(position, std::move(item), slot);
+    }
+
+    void siftDown(size_type position)
+    {
+        const size_type size = items.getSize();
+        Type item = std::move(items[position]);
+        std::uint32_t slot = slotOf[position];
+        for(;;)
+        {
+            size_type child = position * Arity + 1;
+            if(child >= size)
+                break;
+            size_type best = child;
+            size_type lastChild = child + Arity < size ? child + Arity : size;
+            for(++child; child < lastChild; ++child)
+            {
+                if(comp(items[child], items[best]))
+                    best = child;
+            }
+            if(!comp(items[best], item))
+                break;
+            place(position, std::move(items[best]), slotOf[best]);
+            position = best;
+        }
+        place(position, std::move(item), slot);
+    }
+
+    // appends item without restoring the heap order, returns its slot
+    std::uint32_t appendItem(const Type& item)
+    {
+        if(items.getSize() >= none)
+            throw std::length_error("Too many items in the priority queue");
+        std::uint32_t slot = slots.acquire(static_cast<std::uint32_t>(items.getSize()));
+        try
+        {
+            slotOf.append(slot);
+            try
+            {
+                items.append(item);
+            }
+            catch(...)
+            {
+                slotOf.popLast();
+                throw;
+            }
+        }
+        catch(...)
+        {
+            slots.release(slot); // no handle to it was given out
+            throw;
+        }
+        return slot;
+    }
+
+    std::uint32_t checkedPositionOf(const Handle& handle) const
+    {
+        if(!slots.isCurrent(handle.slot, handle.generation))
+            throw std::invalid_argument("Attempt to use a stale handle");
+        return slots[handle.slot];
+    }
+
+public:
+    explicit PriorityQueue(const Compare& compare = Compare()) : comp(compare)
+    {
+
+    }
+
+    bool isEmpty() const
+    {
+        return items.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return items.getSize();
+    }
+
+    // O(log n / log Arity)
+    Handle push(const Type& item)
+    {
+        std::uint32_t slot = appendItem(item);
+        siftUp(items.getSize() - 1);
+        return Handle(slot, slots.generationOf(slot));
+    }
+
+    const_reference top() const
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to read the top of an empty priority queue");
+        return items[0];
+    }
+
+    // removes and returns top(); O(Arity log n / log Arity)
+    Type pop()
+    {
+        if(isEmpty())
+            throw std::logic_error("Attempt to pop from an empty priority queue");
+
+        Type returned = std::move(items[0]);
+        slots.release(slotOf[0]);
+
+        size_type lastPosition = items.getSize() - 1;
+        if(lastPosition > 0)
+        {
+            items[0] = std::move(items[lastPosition]);
+            slotOf[0] = slotOf[lastPosition];
+            slots[slotOf[0]] = 0;
+        }
+        items.popLast();
+        slotOf.popLast();
+        if(!items.isEmpty())
+            siftDown(0);
+        return returned;
+    }
+
+    // Adds [first, last) in O(n + k) by rebuilding the heap bottom-up (Floyd), instead of
+    // k pushes. The added items get no handles back; handles of the present items stay valid.
+    template <typename InputIterator>
+    void heapify(InputIterator first, InputIterator last)
+    {
+        for(; first != last; ++first)
+            appendItem(*first);
+        const size_type size = items.getSize();
+        if(size < 2)
+            return;
+        for(size_type position = (size - 2) / Arity + 1; position-- > 0; )
+            siftDown(position);
+    }
+
+    // false once the item was popped
+    bool isValid(const Handle& handle) const
+    {
+        return slots.isCurrent(handle.slot, handle.generation);
+    }
+
+    // throws std::invalid_argument for a stale handle
+    const_reference get(const Handle& handle) const
+    {
+        return items[checkedPositionOf(handle)];
+    }
+
+    // Replaces the item of handle by one that compares less or equal and moves it up accordingly.
+    // Throws std::invalid_argument for a stale handle or an item that would have to move down.
+    void decreaseKey(const Handle& handle, const Type& item)
+    {
+        std::uint32_t position = checkedPositionOf(handle);
+        if(comp(items[position], item))
+            throw std::invalid_argument("decreaseKey() needs an item which does not compare greater");
+        items[position] = item;
+        siftUp(position);
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PRIORITYQUEUE_H
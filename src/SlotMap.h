@@ -0,0 +1,192 @@
+#ifndef AISDI_LINEAR_SLOTMAP_H
+#define AISDI_LINEAR_SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "GenerationalSlots.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Values packed densely in a Vector, addressed by generational handles. A handle names a slot,
+// the slot holds the dense index of its value. Erase moves the last value into the hole and
+// fixes the slot of the moved value, so iteration always walks one contiguous block, in no
+// particular order. An erased slot is reused with its generation bumped, older handles to it
+// go stale (generations wrap after 2^32 reuses of one slot). Type has to be default constructible.
+template <typename Type>
+class SlotMap
+{
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using iterator = typename Vector<Type>::iterator;
+    using const_iterator = typename Vector<Type>::const_iterator;
+
+    using Handle = detail::GenerationalHandle<SlotMap>;
+
+private:
+    static const std::uint32_t none = detail::GenerationalSlots<std::uint32_t>::none;
+
+    Vector<Type> values;
+    Vector<std::uint32_t> slotOfValue; // parallel to values
+    detail::GenerationalSlots<std::uint32_t> slots; // the dense index of every value
+
+    // dense index of the value of handle, none when the handle is stale
+    std::uint32_t indexOf(const Handle& handle) const
+    {
+        if(!slots.isCurrent(handle.slot, handle.generation))
+            return none;
+        return slots[handle.slot];
+    }
+
+    std::uint32_t checkedIndexOf(const Handle& handle) const
+    {
+        std::uint32_t index = indexOf(handle);
+        if(index == none)
+            throw std::invalid_argument("Attempt to use a stale handle");
+        return index;
+    }
+
+public:
+    SlotMap()
+    {
+
+    }
+
+    bool isEmpty() const
+    {
+        return values.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return values.getSize();
+    }
+
+    // O(1) amortized
+    Handle insert(const Type& item)
+    {
+        if(values.getSize() >= none)
+            throw std::length_error("Too many values in the slot map");
+        std::uint32_t slot = slots.acquire(static_cast<std::uint32_t>(values.getSize()));
+        try
+        {
+            slotOfValue.append(slot);
+            try
+            {
+                values.append(item);
+            }
+            catch(...)
+            {
+                slotOfValue.popLast();
+                throw;
+            }
+        }
+        catch(...)
+        {
+            slots.release(slot); // no handle to it was given out
+            throw;
+        }
+        return Handle(slot, slots.generationOf(slot));
+    }
+
+    // O(1); throws std::invalid_argument for a stale handle
+    void erase(const Handle& handle)
+    {
+        std::uint32_t index = checkedIndexOf(handle);
+        std::uint32_t lastIndex = static_cast<std::uint32_t>(values.getSize() - 1);
+        if(index != lastIndex)
+        {
+            values[index] = std::move(values[lastIndex]);
+            slotOfValue[index] = slotOfValue[lastIndex];
+            slots[slotOfValue[index]] = index;
+        }
+        values.popLast();
+        slotOfValue.popLast();
+        slots.release(handle.slot);
+    }
+
+    bool isValid(const Handle& handle) const
+    {
+        return indexOf(handle) != none;
+    }
+
+    // nullptr for a stale handle; the pointer is valid until the next insert or erase
+    Type * find(const Handle& handle)
+    {
+        std::uint32_t index = indexOf(handle);
+        return index == none ? nullptr : &values[index];
+    }
+
+    const Type * find(const Handle& handle) const
+    {
+        std::uint32_t index = indexOf(handle);
+        return index == none ? nullptr : &values[index];
+    }
+
+    // throws std::invalid_argument for a stale handle
+    Type& get(const Handle& handle)
+    {
+        return values[checkedIndexOf(handle)];
+    }
+
+    const Type& get(const Handle& handle) const
+    {
+        return values[checkedIndexOf(handle)];
+    }
+
+    // handle of the value at dense index (0..getSize() - 1), e.g. found while iterating
+    Handle handleAt(size_type index) const
+    {
+        if(index >= values.getSize())
+            throw std::out_of_range("Attempt to take a handle beyond the values");
+        std::uint32_t slot = slotOfValue[index];
+        return Handle(slot, slots.generationOf(slot));
+    }
+
+    // all handles go stale
+    void clear()
+    {
+        while(!values.isEmpty())
+            erase(handleAt(values.getSize() - 1));
+    }
+
+    // the dense values, in no particular order
+    iterator begin()
+    {
+        return values.begin();
+    }
+
+    iterator end()
+    {
+        return values.end();
+    }
+
+    const_iterator cbegin() const
+    {
+        return values.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return values.cend();
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SLOTMAP_H
@@ -0,0 +1,280 @@
+#ifndef AISDI_LINEAR_THREADPOOL_H
+#define AISDI_LINEAR_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "LinkedList.h"
+#include "WorkStealingDeque.h"
+
+namespace aisdi
+{
+
+// Fork-join scheduler: every worker owns a WorkStealingDeque, idle workers steal from the others.
+// Tasks spawned from inside a task go to the spawning worker's deque, tasks spawned
+// from any other thread go to a shared injection queue.
+class ThreadPool
+{
+public:
+    using size_type = std::size_t;
+
+    class TaskGroup
+    {
+        friend ThreadPool;
+    public:
+        TaskGroup() : pending(0), failed(false)
+        {
+
+        }
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+    private:
+        std::atomic<size_type> pending;
+        std::atomic<bool> failed;
+        std::exception_ptr error; // first exception thrown by a task, written once guarded by failed
+    };
+
+private:
+    struct Task
+    {
+        std::function<void()> function;
+        TaskGroup * group;
+    };
+
+    struct Worker
+    {
+        Worker() : pool(nullptr), index(0), randomState(0)
+        {
+
+        }
+
+        WorkStealingDeque<Task *> deque;
+        std::thread thread;
+        ThreadPool * pool;
+        size_type index;
+        std::uint32_t randomState;
+    };
+
+    Worker * workers;
+    size_type threadCount;
+
+    std::mutex injectionMutex;
+    LinkedList<Task *> injectionQueue;
+
+    std::atomic<size_type> queuedTasks; // spawned but not yet taken by anyone
+    std::atomic<size_type> sleepingWorkers;
+    std::atomic<bool> stopping;
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+
+    static Worker *& currentWorker()
+    {
+        static thread_local Worker * worker = nullptr;
+        return worker;
+    }
+
+    Worker * ownWorker() const
+    {
+        Worker * worker = currentWorker();
+        return worker && worker->pool == this ? worker : nullptr;
+    }
+
+    static std::uint32_t nextRandom(std::uint32_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    Task * takeInjected()
+    {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        if(injectionQueue.isEmpty())
+            return nullptr;
+        return injectionQueue.popFirst();
+    }
+
+    Task * findTask(Worker * worker)
+    {
+        Task * task = nullptr;
+        if(worker && worker->deque.pop(task))
+            return task;
+        if((task = takeInjected()) != nullptr)
+            return task;
+
+        std::uint32_t seed = worker ? nextRandom(worker->randomState) : 0;
+        for(size_type i = 0; i < threadCount; ++i)
+        {
+            Worker& victim = workers[(seed + i) % threadCount];
+            if(&victim != worker && victim.deque.steal(task))
+                return task;
+        }
+        return nullptr;
+    }
+
+    void run(Task * task)
+    {
+        queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+        TaskGroup * group = task->group;
+        try
+        {
+            task->function();
+        }
+        catch(...)
+        {
+            if(!group->failed.exchange(true))
+                group->error = std::current_exception();
+        }
+        delete task;
+        group->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void workerLoop(Worker * worker)
+    {
+        currentWorker() = worker;
+        while(!stopping.load(std::memory_order_acquire))
+        {
+            Task * task = findTask(worker);
+            if(task)
+            {
+                run(task);
+                continue;
+            }
+
+            // going to sleep has to be ordered against spawn(), see the comment there
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            wakeUp.wait(lock, [this]
+            {
+                return queuedTasks.load(std::memory_order_seq_cst) != 0 || stopping.load(std::memory_order_seq_cst);
+            });
+            sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+        }
+        currentWorker() = nullptr;
+    }
+
+public:
+    static size_type defaultThreadCount()
+    {
+        size_type hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+    explicit ThreadPool(size_type initThreadCount = defaultThreadCount())
+        : workers(nullptr), threadCount(initThreadCount), queuedTasks(0), sleepingWorkers(0), stopping(false)
+    {
+        if(threadCount == 0)
+            throw std::invalid_argument("ThreadPool needs at least one thread");
+
+        workers = new Worker [threadCount];
+        for(size_type i = 0; i < threadCount; ++i)
+        {
+            workers[i].pool = this;
+            workers[i].index = i;
+            workers[i].randomState = static_cast<std::uint32_t>(2654435761u * (i + 1));
+        }
+        for(size_type i = 0; i < threadCount; ++i)
+        {
+            workers[i].thread = std::thread(&ThreadPool::workerLoop, this, &workers[i]);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping.store(true, std::memory_order_seq_cst);
+        }
+        wakeUp.notify_all();
+        for(size_type i = 0; i < threadCount; ++i)
+        {
+            workers[i].thread.join();
+        }
+        delete [] workers;
+        while(!injectionQueue.isEmpty())
+        {
+            delete injectionQueue.popFirst();
+        }
+    }
+
+    size_type getThreadCount() const
+    {
+        return threadCount;
+    }
+
+    void spawn(TaskGroup& group, std::function<void()> function)
+    {
+        // counted once it exists and uncounted if queueing throws: wait() must not spin on a task that never runs
+        std::unique_ptr<Task> task(new Task { std::move(function), &group });
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+        try
+        {
+            Worker * worker = ownWorker();
+            if(worker)
+            {
+                worker->deque.push(task.get());
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(injectionMutex);
+                injectionQueue.append(task.get());
+            }
+        }
+        catch(...)
+        {
+            group.pending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        task.release(); // owned by the queue now, deleted by run()
+
+        // Both counters are seq_cst: either a worker about to sleep sees the new task,
+        // or we see it sleeping and wake it up under sleepMutex.
+        queuedTasks.fetch_add(1, std::memory_order_seq_cst);
+        if(sleepingWorkers.load(std::memory_order_seq_cst) != 0)
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            wakeUp.notify_one();
+        }
+    }
+
+    // Runs other tasks while waiting, so it may be called from inside a task without deadlocking.
+    // Rethrows the first exception thrown by any task of the group.
+    void wait(TaskGroup& group)
+    {
+        Worker * worker = ownWorker();
+        while(group.pending.load(std::memory_order_acquire) != 0)
+        {
+            Task * task = findTask(worker);
+            if(task)
+                run(task);
+            else
+                std::this_thread::yield();
+        }
+
+        if(group.failed.load(std::memory_order_acquire))
+        {
+            std::exception_ptr error = group.error;
+            group.error = nullptr;
+            group.failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_THREADPOOL_H
@@ -0,0 +1,305 @@
+#ifndef AISDI_LINEAR_TRACE_H
+#define AISDI_LINEAR_TRACE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Operations on a sequence container, recorded by TraceRecorder and replayed by aisdiLinearBench
+// --replay. Elements are not recorded, only what is done where: positions are indexes at the
+// moment of the operation, so a trace replays the same way on any container.
+enum class TraceOperation : std::uint8_t
+{
+    append,
+    prepend,
+    insert, // before the element at argument
+    erase, // the element at argument
+    popFirst,
+    popLast,
+    iterate // over the first argument elements
+};
+
+// The operation with its argument done repeat times in a row (consecutive equal events are
+// stored once, so e.g. filling a container takes a few bytes).
+struct TraceEvent
+{
+    TraceOperation operation;
+    std::uint64_t argument;
+    std::uint64_t repeat;
+
+    bool hasArgument() const
+    {
+        return operation == TraceOperation::insert || operation == TraceOperation::erase
+            || operation == TraceOperation::iterate;
+    }
+
+    bool isRepeatOf(const TraceEvent& other) const
+    {
+        return operation == other.operation && argument == other.argument;
+    }
+};
+
+using Trace = Vector<TraceEvent>;
+
+inline const char * traceOperationName(TraceOperation operation)
+{
+    switch(operation)
+    {
+    case TraceOperation::append:
+        return "append";
+    case TraceOperation::prepend:
+        return "prepend";
+    case TraceOperation::insert:
+        return "insert";
+    case TraceOperation::erase:
+        return "erase";
+    case TraceOperation::popFirst:
+        return "popFirst";
+    case TraceOperation::popLast:
+        return "popLast";
+    case TraceOperation::iterate:
+        return "iterate";
+    }
+    throw std::invalid_argument("Unknown trace operation");
+}
+
+inline TraceOperation parseTraceOperation(const std::string& name)
+{
+    for(std::uint8_t code = 0; code <= static_cast<std::uint8_t>(TraceOperation::iterate); ++code)
+    {
+        const TraceOperation operation = static_cast<TraceOperation>(code);
+        if(name == traceOperationName(operation))
+            return operation;
+    }
+    throw std::invalid_argument("Unknown trace operation: " + name);
+}
+
+// Binary: the 8 bytes of traceMagic, then every event as its operation code, with the repeatFlag
+// bit set when a repeat count follows, then the argument (if it has one) and the count as
+// LEB128 varints. Text: one event per line, "insert 12" or "append *1000" (repeated 1000
+// times); empty lines and lines starting with # are skipped.
+enum class TraceFormat
+{
+    binary,
+    text
+};
+
+const char traceMagic[8] = { 'A', 'I', 'S', 'D', 'I', 'T', 'R', '1' };
+const std::uint8_t repeatFlag = 0x80;
+
+// Writes events as they come, joining the repeats of one event; the last one is held back
+// until a different event, flush() or destruction.
+class TraceWriter
+{
+public:
+    TraceWriter(std::ostream& out, TraceFormat format) : out(out), format(format), pending { TraceOperation::append, 0, 0 }
+    {
+        if(format == TraceFormat::binary)
+            out.write(traceMagic, sizeof(traceMagic));
+        else
+            out << "# aisdi trace\n";
+    }
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    ~TraceWriter()
+    {
+        flush();
+    }
+
+    void write(const TraceEvent& event)
+    {
+        if(event.repeat == 0)
+            return;
+        if(pending.repeat > 0 && pending.isRepeatOf(event))
+        {
+            pending.repeat += event.repeat;
+            return;
+        }
+        writePending();
+        pending = event;
+    }
+
+    void write(TraceOperation operation, std::uint64_t argument = 0)
+    {
+        write(TraceEvent { operation, argument, 1 });
+    }
+
+    void flush()
+    {
+        writePending();
+        out.flush();
+    }
+
+private:
+    std::ostream& out;
+    const TraceFormat format;
+    TraceEvent pending; // repeat 0: none
+
+    void writeVarint(std::uint64_t value)
+    {
+        while(value >= 0x80)
+        {
+            out.put(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.put(static_cast<char>(value));
+    }
+
+    void writePending()
+    {
+        if(pending.repeat == 0)
+            return;
+        if(format == TraceFormat::binary)
+        {
+            const std::uint8_t code = static_cast<std::uint8_t>(pending.operation);
+            out.put(static_cast<char>(pending.repeat > 1 ? code | repeatFlag : code));
+            if(pending.hasArgument())
+                writeVarint(pending.argument);
+            if(pending.repeat > 1)
+                writeVarint(pending.repeat);
+        }
+        else
+        {
+            out << traceOperationName(pending.operation);
+            if(pending.hasArgument())
+                out << " " << pending.argument;
+            if(pending.repeat > 1)
+                out << " *" << pending.repeat;
+            out << "\n";
+        }
+        pending.repeat = 0;
+    }
+};
+
+inline void writeTrace(std::ostream& out, const Trace& trace, TraceFormat format)
+{
+    TraceWriter writer(out, format);
+    for(const TraceEvent& event : trace)
+        writer.write(event);
+}
+
+namespace detail
+{
+
+inline std::uint64_t readTraceVarint(std::istream& in)
+{
+    std::uint64_t value = 0;
+    for(unsigned shift = 0; shift < 64; shift += 7)
+    {
+        const int byte = in.get();
+        if(byte == std::char_traits<char>::eof())
+            throw std::runtime_error("Trace ends inside a number");
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if((byte & 0x80) == 0)
+            return value;
+    }
+    throw std::runtime_error("Trace number too long");
+}
+
+inline Trace readBinaryTrace(std::istream& in)
+{
+    Trace trace;
+    for(int code = in.get(); code != std::char_traits<char>::eof(); code = in.get())
+    {
+        const std::uint8_t operationCode = static_cast<std::uint8_t>(code) & ~repeatFlag;
+        if(operationCode > static_cast<std::uint8_t>(TraceOperation::iterate))
+            throw std::runtime_error("Unknown trace operation code " + std::to_string(code));
+        TraceEvent event { static_cast<TraceOperation>(operationCode), 0, 1 };
+        if(event.hasArgument())
+            event.argument = readTraceVarint(in);
+        if(code & repeatFlag)
+            event.repeat = readTraceVarint(in);
+        trace.append(event);
+    }
+    return trace;
+}
+
+inline std::uint64_t parseTraceNumber(const std::string& text, std::size_t lineNumber)
+{
+    std::size_t parsedLength = 0;
+    std::uint64_t number = 0;
+    if(!text.empty() && text[0] >= '0' && text[0] <= '9') // stoull would take "-1" too
+    {
+        try
+        {
+            number = std::stoull(text, &parsedLength);
+        }
+        catch(const std::out_of_range&)
+        {
+            parsedLength = 0;
+        }
+    }
+    if(parsedLength == 0 || parsedLength != text.size())
+        throw std::runtime_error("Trace line " + std::to_string(lineNumber) + ": not a number: " + text);
+    return number;
+}
+
+inline Trace readTextTrace(std::istream& in)
+{
+    Trace trace;
+    std::string line;
+    for(std::size_t lineNumber = 1; std::getline(in, line); ++lineNumber)
+    {
+        std::istringstream words(line);
+        std::string name;
+        if(!(words >> name) || name[0] == '#')
+            continue;
+        TraceEvent event { TraceOperation::append, 0, 1 };
+        try
+        {
+            event.operation = parseTraceOperation(name);
+        }
+        catch(const std::invalid_argument& e)
+        {
+            throw std::runtime_error("Trace line " + std::to_string(lineNumber) + ": " + e.what());
+        }
+        std::string word;
+        if(event.hasArgument())
+        {
+            if(!(words >> word))
+                throw std::runtime_error("Trace line " + std::to_string(lineNumber) + ": " + name + " needs a position");
+            event.argument = parseTraceNumber(word, lineNumber);
+        }
+        if(words >> word)
+        {
+            if(word[0] != '*')
+                throw std::runtime_error("Trace line " + std::to_string(lineNumber) + ": unexpected " + word);
+            event.repeat = parseTraceNumber(word.substr(1), lineNumber);
+        }
+        trace.append(event);
+    }
+    return trace;
+}
+
+} // namespace detail
+
+// Either format, told apart by the magic bytes. Throws std::runtime_error on a malformed trace.
+inline Trace readTrace(std::istream& in)
+{
+    char magic[sizeof(traceMagic)] = {};
+    in.read(magic, sizeof(magic));
+    if(in.gcount() == static_cast<std::streamsize>(sizeof(magic)) && std::equal(magic, magic + sizeof(magic), traceMagic))
+        return detail::readBinaryTrace(in);
+    in.clear();
+    in.seekg(0);
+    if(!in)
+        throw std::runtime_error("Cannot rewind the trace to read it as text");
+    return detail::readTextTrace(in);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_TRACE_H
@@ -0,0 +1,119 @@
+#ifndef AISDI_LINEAR_TRACERECORDER_H
+#define AISDI_LINEAR_TRACERECORDER_H
+
+#include <cstddef>
+
+#include "Trace.h"
+
+namespace aisdi
+{
+
+// Records the operations done through it on a container (Vector or LinkedList, or anything
+// with their interface and indexOf()) to a TraceWriter, e.g. in place of the container in a
+// live program, to replay the trace later with aisdiLinearBench --replay. Positions are taken
+// with indexOf(), O(1) on Vector, O(distance) on LinkedList unless its positional index is on.
+// Iteration the program does by itself is not seen, iterate() visits and records it.
+template <typename Container>
+class TraceRecorder
+{
+public:
+    using size_type = typename Container::size_type;
+    using value_type = typename Container::value_type;
+    using const_iterator = typename Container::const_iterator;
+
+    TraceRecorder(Container& container, TraceWriter& writer) : container(container), writer(writer)
+    {
+
+    }
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    Container& get()
+    {
+        return container;
+    }
+
+    const Container& get() const
+    {
+        return container;
+    }
+
+    bool isEmpty() const
+    {
+        return container.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return container.getSize();
+    }
+
+    void append(const value_type& item)
+    {
+        container.append(item);
+        writer.write(TraceOperation::append);
+    }
+
+    void prepend(const value_type& item)
+    {
+        container.prepend(item);
+        writer.write(TraceOperation::prepend);
+    }
+
+    void insert(const const_iterator& insertPosition, const value_type& item)
+    {
+        const size_type index = container.indexOf(insertPosition);
+        container.insert(insertPosition, item);
+        writer.write(TraceOperation::insert, index);
+    }
+
+    value_type popFirst()
+    {
+        value_type item = container.popFirst();
+        writer.write(TraceOperation::popFirst);
+        return item;
+    }
+
+    value_type popLast()
+    {
+        value_type item = container.popLast();
+        writer.write(TraceOperation::popLast);
+        return item;
+    }
+
+    void erase(const const_iterator& position)
+    {
+        const size_type index = container.indexOf(position);
+        container.erase(position);
+        writer.write(TraceOperation::erase, index);
+    }
+
+    // Calls function(item) for the first count items (all of them if there are fewer).
+    template <typename Function>
+    void iterate(size_type count, Function function) const
+    {
+        size_type visited = 0;
+        for(const_iterator i = container.cbegin(); visited < count && i != container.cend(); ++i, ++visited)
+            function(*i);
+        writer.write(TraceOperation::iterate, visited);
+    }
+
+    const_iterator cbegin() const
+    {
+        return container.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return container.cend();
+    }
+
+private:
+    Container& container;
+    TraceWriter& writer;
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_TRACERECORDER_H
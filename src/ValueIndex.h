@@ -0,0 +1,162 @@
+#ifndef AISDI_LINEAR_VALUEINDEX_H
+#define AISDI_LINEAR_VALUEINDEX_H
+
+#include <cstddef>
+#include <functional>
+
+#include "HashIndex.h"
+
+namespace aisdi
+{
+
+// Lookup policies decide whether a list keeps an index from item values to their nodes.
+// The list reports every node entering it, leaving it or moving in memory, Index only maps.
+
+// No index: the hooks are empty and compile away, find() and friends are not available.
+struct NoValueIndex
+{
+    template <typename Type, typename Node>
+    class Index
+    {
+    public:
+        static const bool enabled = false;
+
+        void linked(const Type&, Node *)
+        {
+
+        }
+
+        void unlinked(const Type&, Node *)
+        {
+
+        }
+
+        void relocated(const Type&, Node *, Node *)
+        {
+
+        }
+
+        void swap(Index&)
+        {
+
+        }
+
+        std::size_t getMemoryUsage() const
+        {
+            return 0;
+        }
+    };
+};
+
+// Hash index over the item values: find, contains and erase by value take expected O(1).
+// The index keeps a copy of every distinct value. Equal items are chained, a value held k times
+// costs O(k) on unlinking or relocating one of them.
+// Items must not be modified in place while they are in the list, the index would not notice:
+// a LinkedList with this index hands them out as const only, its iterators are like std::set ones.
+template <template <typename> class Hash = std::hash, template <typename> class KeyEqual = std::equal_to>
+struct HashValueIndex
+{
+    template <typename Type, typename Node>
+    class Index
+    {
+    public:
+        static const bool enabled = true;
+
+        // one of the nodes holding value, nullptr if there is none
+        Node * find(const Type& value) const
+        {
+            Node * const * found = heads.find(value);
+            return found ? *found : nullptr;
+        }
+
+        void linked(const Type& value, Node * node)
+        {
+            Node ** head = heads.find(value);
+            if(!head)
+            {
+                heads.insert(value, node);
+                return;
+            }
+            // node goes second in the chain of equal items
+            Node ** next = duplicates.find(*head);
+            if(next)
+            {
+                Node * successor = *next; // insert() may rehash under next
+                duplicates.insert(node, successor);
+                *duplicates.find(*head) = node;
+            }
+            else
+            {
+                duplicates.insert(*head, node);
+            }
+        }
+
+        void unlinked(const Type& value, Node * node)
+        {
+            Node ** head = heads.find(value);
+            Node ** next = duplicates.find(node);
+            Node * successor = next ? *next : nullptr;
+            if(next)
+                duplicates.erase(node);
+            if(*head == node)
+            {
+                if(successor)
+                    *head = successor;
+                else
+                    heads.erase(value);
+                return;
+            }
+            Node * previous = *head;
+            while(*duplicates.find(previous) != node)
+                previous = *duplicates.find(previous);
+            if(successor)
+                *duplicates.find(previous) = successor;
+            else
+                duplicates.erase(previous);
+        }
+
+        // node moved from from to to in memory, see LinkedList::defragment()
+        void relocated(const Type& value, Node * from, Node * to)
+        {
+            Node ** head = heads.find(value);
+            if(!duplicates.isEmpty())
+            {
+                Node ** next = duplicates.find(from);
+                if(next)
+                {
+                    Node * successor = *next;
+                    duplicates.erase(from);
+                    duplicates.insert(to, successor);
+                }
+                if(*head != from)
+                {
+                    Node * previous = *head;
+                    while(*duplicates.find(previous) != from)
+                        previous = *duplicates.find(previous);
+                    *duplicates.find(previous) = to;
+                }
+            }
+            if(*head == from)
+                *head = to;
+        }
+
+        void swap(Index& other)
+        {
+            heads.swap(other.heads);
+            duplicates.swap(other.duplicates);
+        }
+
+        std::size_t getMemoryUsage() const
+        {
+            return heads.getMemoryUsage() + duplicates.getMemoryUsage();
+        }
+
+    private:
+        HashIndex<Type, Node *, Hash<Type>, KeyEqual<Type>> heads; // value -> first node of its chain
+        HashIndex<Node *, Node *> duplicates; // node -> next node with an equal item
+    };
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VALUEINDEX_H
@@ -4,6 +4,11 @@
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "AllocationStats.h"
+#include "HotPathHooks.h"
 
 namespace aisdi
 {
@@ -30,6 +35,7 @@ private:
     pointer dataBlock;
     size_type count;
     size_type capacity;
+    AllocationStats * allocationStats; // optional, nullptr when disabled
 
     pointer allocBlock(size_type blockSize)
     {
@@ -39,19 +45,30 @@ private:
         }
         else
         {
-            return new value_type [blockSize];
+            pointer block = new value_type [blockSize];
+            if(allocationStats)
+                allocationStats->allocated(blockSize * sizeof(value_type));
+            return block;
         }
     }
 
-    void deallocBlock(pointer & dataBlock)
+    void deallocBlock(pointer & dataBlock, size_type blockSize)
     {
         if(dataBlock)
         {
             delete [] dataBlock;
             dataBlock = nullptr;
+            if(allocationStats)
+                allocationStats->freed(blockSize * sizeof(value_type));
         }
     }
 
+    void reallocated()
+    {
+        if(allocationStats)
+            ++allocationStats->reallocations;
+    }
+
     size_type newCapacity()
     {
         return capacity == 0 ? 8 : capacity * 2;
@@ -62,14 +79,76 @@ private:
         return count >= capacity;
     }
 
+    // Elements go to a new block by move when that cannot throw (or they cannot be copied), else by
+    // copy, so that a throwing copy leaves the old block whole, as std::move_if_noexcept does.
+    using relocated_reference = typename std::conditional<std::is_nothrow_move_assignable<Type>::value
+        || !std::is_copy_assignable<Type>::value, Type&&, const Type&>::type;
+
+    static relocated_reference relocated(Type& item)
+    {
+        return static_cast<relocated_reference>(item);
+    }
+
+    template <typename Item>
+    void appendItem(Item&& item)
+    {
+        if(noSpace())
+        {
+            AISDI_LINEAR_HOT_PATH(reallocation, "Vector", count);
+            pointer newDataBlock = allocBlock(newCapacity());
+            for(size_type i = 0; i < count; i++)
+            {
+                newDataBlock[i] = relocated(dataBlock[i]);
+            }
+            deallocBlock(dataBlock, capacity);
+            dataBlock = newDataBlock;
+            capacity = newCapacity();
+            reallocated();
+        }
+        dataBlock[count++] = std::forward<Item>(item);
+    }
+
+    template <typename Item>
+    void insertItem(const const_iterator& insertPosition, Item&& item)
+    {
+        if(noSpace())
+        {
+            AISDI_LINEAR_HOT_PATH(reallocation, "Vector", count);
+            pointer newDataBlock = allocBlock(newCapacity());
+            for(size_type i = 0; i < insertPosition.index; i++)
+            {
+                newDataBlock[i] = relocated(dataBlock[i]);
+            }
+            for(size_type i = count; i > insertPosition.index; i--)
+            {
+                newDataBlock[i] = relocated(dataBlock[i - 1]);
+            }
+            newDataBlock[insertPosition.index] = std::forward<Item>(item);
+            deallocBlock(dataBlock, capacity);
+            dataBlock = newDataBlock;
+            capacity = newCapacity();
+            reallocated();
+        }
+        else
+        {
+            AISDI_LINEAR_HOT_PATH(traversal, "Vector", count - insertPosition.index);
+            for(size_type i = count; i > insertPosition.index; i--)
+            {
+                dataBlock[i] = std::move(dataBlock[i - 1]);
+            }
+            dataBlock[insertPosition.index] = std::forward<Item>(item);
+        }
+        count++;
+    }
+
 public:
-    Vector() : dataBlock(nullptr), count(0), capacity(0) // lazy initialization, no memory allocated at the beginning
+    Vector() : dataBlock(nullptr), count(0), capacity(0), allocationStats(nullptr)
     {
         capacity = newCapacity();
-        dataBlock = allocBlock(newCapacity());
+        dataBlock = allocBlock(capacity);
     }
 
-    Vector(std::initializer_list<Type> initList) : dataBlock(nullptr), count(0), capacity(0)
+    Vector(std::initializer_list<Type> initList) : dataBlock(nullptr), count(0), capacity(0), allocationStats(nullptr)
     {
         capacity = initList.size();
         dataBlock = allocBlock(capacity);
@@ -79,30 +158,34 @@ public:
         }
     }
 
-    Vector(const Vector& otherVector) : dataBlock(nullptr), count(0), capacity(0)
+    Vector(const Vector& otherVector) : dataBlock(nullptr), count(0), capacity(0), allocationStats(nullptr)
     {
         *this = otherVector;
     }
 
-    Vector(Vector&& otherVector): dataBlock(otherVector.dataBlock), count(otherVector.count), capacity(otherVector.capacity)
+    Vector(Vector&& otherVector): dataBlock(otherVector.dataBlock), count(otherVector.count), capacity(otherVector.capacity),
+        allocationStats(otherVector.allocationStats)
     {
         otherVector.dataBlock = nullptr;
         otherVector.count = 0;
         otherVector.capacity = 0;
+        otherVector.allocationStats = nullptr;
     }
 
     ~Vector()
     {
-        deallocBlock(dataBlock);
+        deallocBlock(dataBlock, capacity);
+        delete allocationStats;
     }
 
     Vector& operator=(const Vector& otherVector)
     {
         if(&otherVector == this)
             return *this;
+        AISDI_LINEAR_HOT_PATH(bulkCopy, "Vector", otherVector.count);
         count = 0;
+        deallocBlock(dataBlock, capacity);
         capacity = otherVector.capacity;
-        deallocBlock(dataBlock);
         dataBlock = allocBlock(capacity);
         for(auto elementIterator = otherVector.begin(); elementIterator != otherVector.end(); ++elementIterator)
         {
@@ -113,14 +196,17 @@ public:
 
     Vector& operator=(Vector&& otherVector)
     {
+        deallocBlock(dataBlock, capacity);
+        delete allocationStats; // the stats go with the block
         count = otherVector.count;
         capacity = otherVector.capacity;
-        deallocBlock(dataBlock);
         dataBlock = otherVector.dataBlock;
+        allocationStats = otherVector.allocationStats;
 
         otherVector.dataBlock = nullptr;
         otherVector.count = 0;
         otherVector.capacity = 0;
+        otherVector.allocationStats = nullptr;
 
         return *this;
     }
@@ -140,64 +226,89 @@ public:
         return capacity;
     }
 
+    // Opt-in accounting of the blocks of this vector from now on; the present block counts as live.
+    // A move takes the stats along with the block, a copy does not inherit them.
+    void enableAllocationStats()
+    {
+        if(allocationStats)
+            return;
+        allocationStats = new AllocationStats();
+        allocationStats->adopted(dataBlock ? capacity * sizeof(value_type) : 0);
+    }
+
+    void disableAllocationStats()
+    {
+        delete allocationStats;
+        allocationStats = nullptr;
+    }
+
+    bool hasAllocationStats() const
+    {
+        return allocationStats != nullptr;
+    }
+
+    // all zero while disabled
+    AllocationStats stats() const
+    {
+        return allocationStats ? *allocationStats : AllocationStats();
+    }
+
+    // O(1)
+    size_type indexOf(const const_iterator& position) const
+    {
+        return position.index;
+    }
+
+    // unchecked, as std::vector::operator[]; iterators check their bounds
+    reference operator[](size_type index)
+    {
+        return dataBlock[index];
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        return dataBlock[index];
+    }
+
     void append(const Type& item)
     {
-        if(noSpace())
-        {
-            pointer newDataBlock = allocBlock(newCapacity());
-            for(size_type i = 0; i < count; i++)
-            {
-                newDataBlock[i] = dataBlock[i];
-            }
-            deallocBlock(dataBlock);
-            dataBlock = newDataBlock;
-            capacity = newCapacity();
-        }
-        dataBlock[count++] = item;
+        appendItem(item);
+    }
+
+    void append(Type&& item)
+    {
+        appendItem(std::move(item));
     }
 
     void prepend(const Type& item)
     {
-        insert(begin(), item);
+        insertItem(begin(), item);
+    }
+
+    void prepend(Type&& item)
+    {
+        insertItem(begin(), std::move(item));
     }
 
     void insert(const const_iterator& insertPosition, const Type& item)
     {
-        if(noSpace())
-        {
-            pointer newDataBlock = allocBlock(newCapacity());
-            for(size_type i = 0; i < insertPosition.index; i++)
-            {
-                newDataBlock[i] = dataBlock[i];
-            }
-            for(size_type i = count; i > insertPosition.index; i--)
-            {
-                newDataBlock[i] = dataBlock[i - 1];
-            }
-            newDataBlock[insertPosition.index] = item;
-            deallocBlock(dataBlock);
-            dataBlock = newDataBlock;
-            capacity = newCapacity();
-        }
-        else
-        {
-            for(size_type i = count; i > insertPosition.index; i--)
-            {
-                dataBlock[i] = dataBlock[i - 1];
-            }
-            dataBlock[insertPosition.index] = item;
-        }
-        count++;
+        insertItem(insertPosition, item);
+    }
+
+    void insert(const const_iterator& insertPosition, Type&& item)
+    {
+        insertItem(insertPosition, std::move(item));
     }
 
     Type popFirst()
     {
         if(isEmpty())
             throw std::logic_error("Vector is empty");
-        Type firstElement = dataBlock[0];
-        for(size_type i = 0; i < count; i++)
+        AISDI_LINEAR_HOT_PATH(traversal, "Vector", count - 1);
+        Type firstElement = std::move(dataBlock[0]);
+        for(size_type i = 0; i + 1 < count; i++)
         {
-            dataBlock[i] = dataBlock[i + 1];
+            dataBlock[i] = std::move(dataBlock[i + 1]);
         }
         count--;
         return firstElement;
@@ -207,26 +318,28 @@ public:
     {
         if(isEmpty())
             throw std::logic_error("Vector is empty");
-        return dataBlock[--count];
+        return std::move(dataBlock[--count]);
     }
 
     void erase(const const_iterator& position)
     {
         if(isEmpty() || position == end()) // throws std::out_of_range when: empty, end operator given
             throw std::out_of_range("Bad iterator");
+        AISDI_LINEAR_HOT_PATH(traversal, "Vector", count - position.index - 1);
         count--;
         for(size_type i = position.index; i < count; i++)
         {
-            dataBlock[i] = dataBlock[i + 1];
+            dataBlock[i] = std::move(dataBlock[i + 1]);
         }
     }
 
     void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
     {
+        AISDI_LINEAR_HOT_PATH(rangeErase, "Vector", lastExcluded.index - firstIncluded.index);
         size_type placeToInsert = firstIncluded.index;
         for(size_type i = lastExcluded.index; i < count; i++)
         {
-            dataBlock[placeToInsert++] = dataBlock[i];
+            dataBlock[placeToInsert++] = std::move(dataBlock[i]);
         }
         count -= (lastExcluded.index - firstIncluded.index);
     }
@@ -0,0 +1,183 @@
+#ifndef AISDI_LINEAR_WORKSTEALINGDEQUE_H
+#define AISDI_LINEAR_WORKSTEALINGDEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace aisdi
+{
+
+// Chase-Lev deque (memory orderings after Le, Pop, Cohen, Zappa Nardelli, PPoPP'13).
+// The owner thread calls push() and pop() at the bottom, any other thread may call steal() at the top.
+// Items are copied in and out with plain atomic loads/stores, so Type should be a pointer or a small handle.
+template <typename Type>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "WorkStealingDeque stores items in std::atomic, Type has to be trivially copyable");
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using reference = Type&;
+    using const_reference = const Type&;
+
+private:
+    using index_type = std::int64_t;
+
+    class CircularArray
+    {
+    public:
+        CircularArray(size_type initCapacity, CircularArray * initRetired)
+            : capacity(initCapacity), mask(initCapacity - 1), items(new std::atomic<Type> [initCapacity]), retired(initRetired)
+        {
+
+        }
+
+        ~CircularArray()
+        {
+            delete [] items;
+        }
+
+        Type get(index_type index) const
+        {
+            return items[index & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(index_type index, const Type& item)
+        {
+            items[index & mask].store(item, std::memory_order_relaxed);
+        }
+
+        size_type capacity;
+        index_type mask; // capacity is always a power of two
+        std::atomic<Type> * items;
+        CircularArray * retired; // older, smaller array; thieves may still be reading it
+    };
+
+    // top and bottom are written by different threads, keep them on separate cache lines
+    std::atomic<index_type> top;
+    char topPadding[64 - sizeof(std::atomic<index_type>)];
+    std::atomic<index_type> bottom;
+    char bottomPadding[64 - sizeof(std::atomic<index_type>)];
+    std::atomic<CircularArray *> array;
+
+    static size_type newCapacity(size_type capacity)
+    {
+        return capacity == 0 ? 8 : capacity * 2; // same policy as Vector
+    }
+
+    CircularArray * grow(CircularArray * oldArray, index_type bottomIndex, index_type topIndex)
+    {
+        auto newArray = new CircularArray(newCapacity(oldArray->capacity), oldArray);
+        for(index_type i = topIndex; i < bottomIndex; ++i)
+        {
+            newArray->put(i, oldArray->get(i));
+        }
+        // publishes copied items before thieves can observe the new array
+        array.store(newArray, std::memory_order_release);
+        return newArray;
+    }
+
+public:
+    WorkStealingDeque() : top(0), bottom(0), array(new CircularArray(newCapacity(0), nullptr))
+    {
+
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    ~WorkStealingDeque()
+    {
+        CircularArray * current = array.load(std::memory_order_relaxed);
+        while(current)
+        {
+            auto retired = current->retired;
+            delete current;
+            current = retired;
+        }
+    }
+
+    // owner only
+    void push(const Type& item)
+    {
+        index_type b = bottom.load(std::memory_order_relaxed);
+        index_type t = top.load(std::memory_order_acquire);
+        CircularArray * a = array.load(std::memory_order_relaxed);
+        if(b - t > static_cast<index_type>(a->capacity) - 1)
+        {
+            a = grow(a, b, t);
+        }
+        a->put(b, item);
+        // a release store instead of the paper's release fence: same cost, and visible to ThreadSanitizer
+        bottom.store(b + 1, std::memory_order_release);
+    }
+
+    // owner only; returns false when the deque is empty or the last item was stolen meanwhile
+    bool pop(Type& item)
+    {
+        index_type b = bottom.load(std::memory_order_relaxed) - 1;
+        CircularArray * a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        index_type t = top.load(std::memory_order_relaxed);
+
+        if(t > b) // empty
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = a->get(b);
+        if(t == b) // last item, race against thieves
+        {
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // any thread; returns false when the deque is empty or another thread took the item first
+    bool steal(Type& item)
+    {
+        index_type t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        index_type b = bottom.load(std::memory_order_acquire);
+
+        if(t >= b)
+            return false;
+
+        CircularArray * a = array.load(std::memory_order_acquire);
+        Type stolen = a->get(t);
+        if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return false;
+
+        item = stolen;
+        return true;
+    }
+
+    // both are only estimates when other threads are operating on the deque
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    size_type getSize() const
+    {
+        index_type b = bottom.load(std::memory_order_relaxed);
+        index_type t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_type>(b - t) : 0;
+    }
+
+    size_type getCapacity() const
+    {
+        return array.load(std::memory_order_relaxed)->capacity;
+    }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_WORKSTEALINGDEQUE_H
@@ -22,25 +22,25 @@ void performLinkedListTest(std::size_t n)
 
   // appending tests
 
-  std::chrono::time_point<std::chrono::system_clock> start, end;
+  std::chrono::time_point<std::chrono::steady_clock> start, end;
   LinkedList<std::string> collection;
   std::cout<<"LinkedList:\n";
 
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection.append("ELEMENCIK");
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   std::chrono::duration<double> timeTaken = end-start;
   std::cout << "Appending "<<n<<" elements takes: " << timeTaken.count() << "s\n";
 
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection.erase(collection.begin());
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   timeTaken = end-start;
   std::cout << "Erasing "<<n<<" elements from the beginning takes: " << timeTaken.count() << "s\n";
 
@@ -51,21 +51,21 @@ void performLinkedListTest(std::size_t n)
 
 
   LinkedList<std::string> collection2;
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection2.prepend("ELEMENCIK");
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   timeTaken = end-start;
   std::cout << "Prepending "<<n<<" elements takes: " << timeTaken.count() << "s\n";
 
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n-1; ++i)
   {
     collection2.erase(collection2.end()-1);
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   timeTaken = end-start;
   std::cout << "Erasing "<<n<<" elements from the end takes: " << timeTaken.count() << "s\n";
 }
@@ -74,46 +74,46 @@ void performVectorTest(std::size_t n)
 {
   // appending tests
 
-  std::chrono::time_point<std::chrono::system_clock> start, end;
+  std::chrono::time_point<std::chrono::steady_clock> start, end;
   Vector<std::string> collection;
   std::cout<<"Vector:\n";
 
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection.append("ELEMENCIK");
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   std::chrono::duration<double> timeTaken = end-start;
   std::cout << "Appending "<<n<<" elements takes: " << timeTaken.count() << "s\n";
 
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection.erase(collection.begin());
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   timeTaken = end-start;
   std::cout << "Erasing "<<n<<" elements from the beginning takes: " << timeTaken.count() << "s\n";
 
    // prepending tests:
 
   Vector<std::string> collection2;
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection2.prepend("ELEMENCIK");
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   timeTaken = end-start;
   std::cout << "Prepending "<<n<<" elements takes: " << timeTaken.count() << "s\n";
 
-  start = std::chrono::system_clock::now();
+  start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < n; ++i)
   {
     collection2.erase(collection2.end()-1);
   }
-  end = std::chrono::system_clock::now();
+  end = std::chrono::steady_clock::now();
   timeTaken = end-start;
   std::cout << "Erasing "<<n<<" elements from the end takes: " << timeTaken.count() << "s\n";
 }
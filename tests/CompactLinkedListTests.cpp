@@ -0,0 +1,312 @@
+#include <CompactLinkedList.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+template <typename T>
+using CompactList = aisdi::CompactLinkedList<T>;
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t,
+      std::string>;
+
+template <typename T>
+T makeItem(int value)
+{
+    return static_cast<T>(value);
+}
+
+template <>
+std::string makeItem<std::string>(int value)
+{
+    return std::to_string(value);
+}
+
+template <typename T>
+void thenListContainsItems(const CompactList<T>& list, const std::vector<int>& expected)
+{
+    std::vector<T> expectedItems;
+    for(int value : expected)
+        expectedItems.push_back(makeItem<T>(value));
+
+    BOOST_CHECK_EQUAL(list.getSize(), expected.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(list), std::end(list), expectedItems.begin(), expectedItems.end());
+
+    std::vector<T> backwards;
+    for(auto it = std::end(list); it != std::begin(list); )
+        backwards.push_back(*--it);
+    BOOST_CHECK_EQUAL_COLLECTIONS(backwards.rbegin(), backwards.rend(), expectedItems.begin(), expectedItems.end());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CompactLinkedListTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    const CompactList<T> list;
+
+    BOOST_CHECK(list.isEmpty());
+    BOOST_CHECK(std::begin(list) == std::end(list));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyList_WhenAppendingAndPrepending_ThenItemsAreInOrder,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+
+    list.append(makeItem<T>(2));
+    list.append(makeItem<T>(3));
+    list.prepend(makeItem<T>(1));
+
+    thenListContainsItems(list, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenInsertingInTheMiddle_ThenItemIsPlacedBeforePosition,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1), makeItem<T>(3) };
+
+    list.insert(std::begin(list) + 1, makeItem<T>(2));
+    list.insert(std::end(list), makeItem<T>(4));
+
+    thenListContainsItems(list, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenPopping_ThenItemsAreReturnedFromBothEnds,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1), makeItem<T>(2), makeItem<T>(3) };
+
+    BOOST_CHECK_EQUAL(list.popFirst(), makeItem<T>(1));
+    BOOST_CHECK_EQUAL(list.popLast(), makeItem<T>(3));
+    thenListContainsItems(list, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyItems_WhenAddingAndPopping_ThenItemsAreMoved)
+{
+    CompactList<std::unique_ptr<int>> list;
+    for(int value = 2; value < 20; ++value) // beyond the first capacity, so the items are relocated
+        list.append(std::unique_ptr<int>(new int(value)));
+    list.prepend(std::unique_ptr<int>(new int(0)));
+    list.insert(std::begin(list) + 1, std::unique_ptr<int>(new int(1)));
+
+    std::unique_ptr<int> first = list.popFirst();
+    std::unique_ptr<int> last = list.popLast();
+
+    BOOST_CHECK_EQUAL(*first, 0);
+    BOOST_CHECK_EQUAL(*last, 19);
+    BOOST_REQUIRE_EQUAL(list.getSize(), 18);
+    BOOST_CHECK_EQUAL(**std::begin(list), 1);
+    BOOST_CHECK_EQUAL(**(std::begin(list) + 1), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenListOfStrings_WhenPopping_ThenItemsAreMovedOut)
+{
+    const std::string longText(40, 'x'); // beyond the small string buffer, so a copy would allocate
+    CompactList<std::string> list;
+    std::string front = longText;
+    std::string back = longText;
+    const char * frontBuffer = front.data();
+    const char * backBuffer = back.data();
+    list.prepend(std::move(front));
+    list.append(std::move(back));
+
+    std::string poppedFirst = list.popFirst();
+    std::string poppedLast = list.popLast();
+
+    BOOST_CHECK_EQUAL(poppedFirst, longText);
+    BOOST_CHECK(poppedFirst.data() == frontBuffer);
+    BOOST_CHECK(poppedLast.data() == backBuffer);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyList_WhenPoppingOrErasing_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+
+    BOOST_CHECK_THROW(list.popFirst(), std::logic_error);
+    BOOST_CHECK_THROW(list.popLast(), std::logic_error);
+    BOOST_CHECK_THROW(list.erase(std::end(list)), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenMovingIteratorsBeyondBounds_ThenExceptionsAreThrown,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1) };
+
+    BOOST_CHECK_THROW(*std::end(list), std::out_of_range);
+    BOOST_CHECK_THROW(++std::end(list), std::out_of_range);
+    BOOST_CHECK_THROW(--std::begin(list), std::out_of_range);
+    BOOST_CHECK_THROW(std::begin(list) + 2, std::range_error);
+    BOOST_CHECK(std::end(list) - 5 == std::begin(list));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoLists_WhenComparingTheirIterators_ThenTheyDiffer,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1) };
+    CompactList<T> other = { makeItem<T>(2) };
+
+    BOOST_CHECK(list.end() != other.end());
+    BOOST_CHECK(list.begin() != other.begin());
+    BOOST_CHECK(list.cbegin() == list.begin());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenErasingRange_ThenRemainingItemsAreLinked,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+    for(int i = 0; i < 6; ++i)
+        list.append(makeItem<T>(i));
+
+    list.erase(std::begin(list) + 1, std::begin(list) + 4);
+
+    thenListContainsItems(list, { 0, 4, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenListWithErasedItems_WhenAppending_ThenFreedSlotsAreReused,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+    for(int i = 0; i < 7; ++i)
+        list.append(makeItem<T>(i));
+    auto capacity = list.getCapacity();
+
+    for(int i = 0; i < 5; ++i)
+        list.popFirst();
+    for(int i = 0; i < 5; ++i)
+        list.append(makeItem<T>(10 + i));
+
+    BOOST_CHECK_EQUAL(list.getCapacity(), capacity);
+    thenListContainsItems(list, { 5, 6, 10, 11, 12, 13, 14 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenArrayGrows_ThenIteratorStaysValid,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1), makeItem<T>(2) };
+    auto it = std::begin(list) + 1;
+    auto capacity = list.getCapacity();
+
+    for(int i = 0; i < 100; ++i)
+        list.append(makeItem<T>(3));
+
+    BOOST_CHECK(list.getCapacity() > capacity);
+    BOOST_CHECK_EQUAL(*it, makeItem<T>(2));
+    BOOST_CHECK_EQUAL(*--it, makeItem<T>(1));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFullList_WhenAppendingItsOwnItem_ThenCopyIsMadeBeforeGrowing,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+    while(list.getSize() + 1 < list.getCapacity())
+        list.append(makeItem<T>(static_cast<int>(list.getSize())));
+
+    list.append(*std::begin(list));
+
+    BOOST_CHECK_EQUAL(*(std::end(list) - 1), makeItem<T>(0));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenShuffledList_WhenCompacting_ThenOrderIsKeptAndSlotsFollowIt,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+    for(int i = 0; i < 20; ++i)
+    {
+        if(i % 2)
+            list.append(makeItem<T>(i));
+        else
+            list.prepend(makeItem<T>(i));
+    }
+    list.erase(std::begin(list));
+    list.erase(std::begin(list) + 5);
+    std::vector<T> before(std::begin(list), std::end(list));
+
+    list.compact();
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(list), std::end(list), before.begin(), before.end());
+    const T * previous = &*std::begin(list);
+    for(auto it = std::begin(list) + 1; it != std::end(list); ++it)
+    {
+        BOOST_CHECK_EQUAL(reinterpret_cast<const char *>(&*it) > reinterpret_cast<const char *>(previous), true);
+        previous = &*it;
+    }
+    list.append(makeItem<T>(100));
+    list.prepend(makeItem<T>(-1));
+    BOOST_CHECK_EQUAL(list.getSize(), before.size() + 2);
+    BOOST_CHECK_EQUAL(*std::begin(list), makeItem<T>(-1));
+    BOOST_CHECK_EQUAL(*(std::end(list) - 1), makeItem<T>(100));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyList_WhenCompacting_ThenItStaysUsable,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list;
+
+    list.compact();
+    list.append(makeItem<T>(1));
+
+    thenListContainsItems(list, { 1 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenCopying_ThenCopyIsIndependent,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1), makeItem<T>(2) };
+
+    CompactList<T> copy(list);
+    CompactList<T> assigned;
+    assigned = list;
+    list.append(makeItem<T>(3));
+
+    thenListContainsItems(copy, { 1, 2 });
+    thenListContainsItems(assigned, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenList_WhenMoving_ThenItemsAreTakenOverAndSourceStaysUsable,
+                              T,
+                              TestedTypes)
+{
+    CompactList<T> list = { makeItem<T>(1), makeItem<T>(2) };
+
+    CompactList<T> moved(std::move(list));
+    CompactList<T> assigned = { makeItem<T>(7) };
+    assigned = std::move(moved);
+    list.append(makeItem<T>(3));
+
+    thenListContainsItems(assigned, { 1, 2 });
+    thenListContainsItems(list, { 3 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,281 @@
+#include <ForwardList.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+template <typename T>
+using ForwardCollection = aisdi::ForwardList<T>;
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t,
+      std::complex<std::int32_t>>;
+
+using std::begin;
+using std::end;
+
+} // namespace
+
+template <typename T>
+void thenCollectionContainsValues(const ForwardCollection<T>& collection,
+                                  std::initializer_list<int> expected)
+{
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
+                                  begin(expected), end(expected));
+    BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+BOOST_AUTO_TEST_SUITE(ForwardListTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    const ForwardCollection<T> collection;
+
+    BOOST_CHECK(collection.isEmpty());
+    BOOST_CHECK_EQUAL(collection.getSize(), 0);
+    BOOST_CHECK(begin(collection) == end(collection));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoCollections_WhenComparingTheirIterators_ThenTheyDiffer,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1 };
+    ForwardCollection<T> other = { 2 };
+
+    BOOST_CHECK(collection.end() != other.end());
+    BOOST_CHECK(collection.begin() != other.begin());
+    BOOST_CHECK(collection.cbegin() == collection.begin());
+    BOOST_CHECK(collection.begin() + 1 == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAppending_ThenItemsAreInOrder,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection;
+
+    collection.append(1);
+    collection.append(2);
+    collection.append(3);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenPrepending_ThenItemIsFirst,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 2, 3 };
+
+    collection.prepend(1);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPrependingAndAppending_ThenTailIsKept,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection;
+
+    collection.prepend(2);
+    collection.append(3);
+    collection.prepend(1);
+    collection.append(4);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenUsedAsQueue_ThenItemsComeOutInFifoOrder,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection;
+
+    collection.append(1);
+    collection.append(2);
+    BOOST_CHECK_EQUAL(collection.popFirst(), T(1));
+    collection.append(3);
+    BOOST_CHECK_EQUAL(collection.popFirst(), T(2));
+    BOOST_CHECK_EQUAL(collection.popFirst(), T(3));
+    BOOST_CHECK(collection.isEmpty());
+    collection.append(4);
+
+    thenCollectionContainsValues(collection, { 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyItems_WhenAddingAndPopping_ThenItemsAreMoved)
+{
+    ForwardCollection<std::unique_ptr<int>> collection;
+    collection.append(std::unique_ptr<int>(new int(2)));
+    collection.prepend(std::unique_ptr<int>(new int(1)));
+    collection.insertAfter(begin(collection) + 1, std::unique_ptr<int>(new int(3)));
+
+    std::unique_ptr<int> first = collection.popFirst();
+    std::unique_ptr<int> second = collection.popFirst();
+
+    BOOST_CHECK_EQUAL(*first, 1);
+    BOOST_CHECK_EQUAL(*second, 2);
+    BOOST_REQUIRE_EQUAL(collection.getSize(), 1);
+    BOOST_CHECK_EQUAL(**begin(collection), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenQueueOfStrings_WhenPoppingFirst_ThenItemIsMovedOut)
+{
+    const std::string longText(40, 'x'); // beyond the small string buffer, so a copy would allocate
+    ForwardCollection<std::string> collection;
+    std::string item = longText;
+    const char * buffer = item.data();
+    collection.append(std::move(item));
+
+    std::string popped = collection.popFirst();
+
+    BOOST_CHECK_EQUAL(popped, longText);
+    BOOST_CHECK(popped.data() == buffer);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPoppingFirst_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection;
+
+    BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAfterPositions_ThenItemsFollowThem,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 2, 4 };
+
+    collection.insertAfter(collection.beforeBegin(), 1);
+    collection.insertAfter(begin(collection) + 1, 3);
+    collection.insertAfter(begin(collection) + 3, 5);
+    collection.append(6);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAfterEnd_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1 };
+
+    BOOST_CHECK_THROW(collection.insertAfter(end(collection), 2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingAfterPositions_ThenItemsAreRemoved,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1, 2, 3, 4 };
+
+    collection.eraseAfter(collection.beforeBegin());
+    collection.eraseAfter(begin(collection) + 1);
+    collection.append(5);
+
+    thenCollectionContainsValues(collection, { 2, 3, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingAfterLastItemOrEnd_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1, 2 };
+
+    BOOST_CHECK_THROW(collection.eraseAfter(begin(collection) + 1), std::out_of_range);
+    BOOST_CHECK_THROW(collection.eraseAfter(end(collection)), std::out_of_range);
+    thenCollectionContainsValues(collection, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingRangeAfterPosition_ThenItemsInBetweenAreRemoved,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1, 2, 3, 4, 5 };
+
+    collection.eraseAfter(begin(collection), begin(collection) + 3);
+    thenCollectionContainsValues(collection, { 1, 4, 5 });
+
+    collection.eraseAfter(begin(collection) + 1, end(collection));
+    collection.append(6);
+    thenCollectionContainsValues(collection, { 1, 4, 6 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenMovingIteratorsBeyondBounds_ThenExceptionsAreThrown,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1 };
+
+    BOOST_CHECK_THROW(*end(collection), std::out_of_range);
+    BOOST_CHECK_THROW(*collection.beforeBegin(), std::out_of_range);
+    BOOST_CHECK_THROW(++end(collection), std::out_of_range);
+    BOOST_CHECK_THROW(begin(collection) + 2, std::range_error);
+    BOOST_CHECK(collection.beforeBegin() + 1 == begin(collection));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenChangingItemThroughIterator_ThenItemIsChanged,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1, 2 };
+
+    *(begin(collection) + 1) = T(5);
+
+    thenCollectionContainsValues(collection, { 1, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCopying_ThenCopyIsIndependent,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1, 2 };
+
+    ForwardCollection<T> copy(collection);
+    ForwardCollection<T> assigned = { 9 };
+    assigned = collection;
+    collection.append(3);
+
+    thenCollectionContainsValues(copy, { 1, 2 });
+    thenCollectionContainsValues(assigned, { 1, 2 });
+    copy.append(4);
+    thenCollectionContainsValues(copy, { 1, 2, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenMoving_ThenItemsAreTakenOverAndSourceIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    ForwardCollection<T> collection = { 1, 2 };
+
+    ForwardCollection<T> moved(std::move(collection));
+    ForwardCollection<T> assigned = { 9 };
+    assigned = std::move(moved);
+    assigned.append(3);
+    collection.append(4);
+
+    thenCollectionContainsValues(assigned, { 1, 2, 3 });
+    thenCollectionContainsValues(collection, { 4 });
+    BOOST_CHECK(moved.isEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,195 @@
+#include <HashIndex.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <unordered_map>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t>;
+
+// all keys collide, so every lookup walks the probe sequence
+struct CollidingHash
+{
+    std::size_t operator()(int) const
+    {
+        return 7;
+    }
+};
+
+// allocations still allowed before operator new throws, unlimited while negative
+long allocationsBeforeFailure = -1;
+
+struct FailingAllocations
+{
+    explicit FailingAllocations(long allowed)
+    {
+        allocationsBeforeFailure = allowed;
+    }
+
+    ~FailingAllocations()
+    {
+        allocationsBeforeFailure = -1;
+    }
+};
+
+} // namespace
+
+// replaces the global allocation functions of the test executable, see FailingAllocations
+void * operator new(std::size_t size)
+{
+    if(allocationsBeforeFailure == 0)
+        throw std::bad_alloc();
+    if(allocationsBeforeFailure > 0)
+        --allocationsBeforeFailure;
+    void * memory = std::malloc(size ? size : 1);
+    if(!memory)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+BOOST_AUTO_TEST_SUITE(HashIndexTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenHashIndex_WhenCreated_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    const aisdi::HashIndex<T, int> index;
+
+    BOOST_CHECK(index.isEmpty());
+    BOOST_CHECK_EQUAL(index.getSize(), 0);
+    BOOST_CHECK(index.find(1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenHashIndex_WhenInsertingKeys_ThenTheyAreFound,
+                              T,
+                              TestedTypes)
+{
+    aisdi::HashIndex<T, int> index;
+
+    for(int i = 0; i < 1000; ++i)
+        BOOST_CHECK(index.insert(static_cast<T>(i), i * 2));
+
+    BOOST_CHECK_EQUAL(index.getSize(), 1000);
+    BOOST_CHECK(index.getCapacity() >= 1000 / 3 * 4);
+    for(int i = 0; i < 1000; ++i)
+    {
+        BOOST_REQUIRE(index.find(static_cast<T>(i)) != nullptr);
+        BOOST_CHECK_EQUAL(*index.find(static_cast<T>(i)), i * 2);
+    }
+    BOOST_CHECK(!index.contains(static_cast<T>(1000)));
+}
+
+BOOST_AUTO_TEST_CASE(GivenHashIndex_WhenInsertingPresentKey_ThenMappedValueIsKept)
+{
+    aisdi::HashIndex<int, int> index;
+    index.insert(1, 10);
+
+    BOOST_CHECK(!index.insert(1, 20));
+
+    BOOST_CHECK_EQUAL(*index.find(1), 10);
+    BOOST_CHECK_EQUAL(index.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHashIndex_WhenErasingAbsentKey_ThenFalseIsReturned)
+{
+    aisdi::HashIndex<int, int> index;
+    index.insert(1, 10);
+
+    BOOST_CHECK(!index.erase(2));
+
+    BOOST_CHECK_EQUAL(index.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollidingKeys_WhenErasingSome_ThenTheOthersAreStillFound)
+{
+    aisdi::HashIndex<int, int, CollidingHash> index;
+    for(int i = 0; i < 20; ++i)
+        index.insert(i, i);
+
+    for(int i = 0; i < 20; i += 3)
+        BOOST_CHECK(index.erase(i));
+
+    for(int i = 0; i < 20; ++i)
+        BOOST_CHECK_EQUAL(index.contains(i), i % 3 != 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHashIndex_WhenChurningKeys_ThenItAgreesWithUnorderedMap)
+{
+    aisdi::HashIndex<std::uint64_t, std::string> index;
+    std::unordered_map<std::uint64_t, std::string> expected;
+    std::uint32_t state = 12345;
+
+    for(int step = 0; step < 20000; ++step)
+    {
+        state = state * 1103515245u + 12345u;
+        std::uint64_t key = (state >> 8) % 512;
+        if(state & 1)
+            BOOST_CHECK_EQUAL(index.insert(key, std::to_string(key)), expected.emplace(key, std::to_string(key)).second);
+        else
+            BOOST_CHECK_EQUAL(index.erase(key), expected.erase(key) == 1);
+    }
+
+    BOOST_CHECK_EQUAL(index.getSize(), expected.size());
+    for(std::uint64_t key = 0; key < 512; ++key)
+    {
+        const std::string * found = index.find(key);
+        BOOST_REQUIRE_EQUAL(found != nullptr, expected.count(key) == 1);
+        if(found)
+            BOOST_CHECK_EQUAL(*found, expected[key]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GivenHashIndex_WhenCleared_ThenItIsEmptyAndReusable)
+{
+    aisdi::HashIndex<int, std::string> index;
+    for(int i = 0; i < 100; ++i)
+        index.insert(i, "value");
+
+    index.clear();
+
+    BOOST_CHECK(index.isEmpty());
+    BOOST_CHECK(!index.contains(5));
+    BOOST_CHECK(index.insert(5, "again"));
+    BOOST_CHECK_EQUAL(*index.find(5), "again");
+}
+
+BOOST_AUTO_TEST_CASE(GivenFailingAllocation_WhenRehashing_ThenIndexIsUnchanged)
+{
+    for(long allowed = 0; allowed < 2; ++allowed) // the hashes, then the entries fail
+    {
+        aisdi::HashIndex<int, int> index;
+        for(int i = 0; i < 6; ++i)
+            index.insert(i, i * 10);
+        const std::size_t capacity = index.getCapacity();
+
+        {
+            FailingAllocations failing(allowed);
+            BOOST_CHECK_THROW(index.insert(6, 60), std::bad_alloc);
+        }
+
+        BOOST_CHECK_EQUAL(index.getSize(), 6);
+        BOOST_CHECK_EQUAL(index.getCapacity(), capacity);
+        for(int i = 0; i < 6; ++i)
+            BOOST_CHECK_EQUAL(*index.find(i), i * 10);
+        BOOST_CHECK(index.insert(6, 60));
+        BOOST_CHECK_EQUAL(*index.find(6), 60);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
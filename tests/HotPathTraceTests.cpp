@@ -0,0 +1,167 @@
+// Built into aisdiLinearHotPathTests, with AISDI_LINEAR_HOT_PATH_TRACE defined for all of it.
+#include <HotPathTrace.h>
+
+#include <Vector.h>
+#include <LinkedList.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#ifndef AISDI_LINEAR_HOT_PATH_TRACE
+#error "The hot path tests need AISDI_LINEAR_HOT_PATH_TRACE defined"
+#endif
+
+namespace
+{
+
+using aisdi::HotPathEvent;
+using aisdi::HotPathEventKind;
+using aisdi::HotPathTracer;
+
+// events of kind of container held by the tracer, of all threads
+std::vector<HotPathEvent> eventsOf(HotPathEventKind kind, const std::string& container)
+{
+    std::vector<HotPathEvent> found;
+    for(const HotPathEvent& event : HotPathTracer::instance().snapshot())
+    {
+        if(event.kind == kind && event.container == container)
+            found.push_back(event);
+    }
+    return found;
+}
+
+std::size_t countOf(HotPathEventKind kind, const std::string& container)
+{
+    return eventsOf(kind, container).size();
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(HotPathTraceTests)
+
+BOOST_AUTO_TEST_CASE(GivenRing_WhenRecordingMoreThanItsCapacity_ThenLatestEventsAreKept)
+{
+    std::unique_ptr<aisdi::HotPathRing> ring(new aisdi::HotPathRing(7));
+    const std::size_t capacity = aisdi::HotPathRing::capacity;
+    const std::size_t recorded = capacity + 10;
+    for(std::size_t i = 0; i < recorded; ++i)
+        ring->record(HotPathEventKind::bulkCopy, "Vector", i, 1, i);
+
+    std::vector<HotPathEvent> events;
+    ring->collect(events);
+
+    BOOST_CHECK_EQUAL(ring->getRecorded(), recorded);
+    BOOST_REQUIRE_EQUAL(events.size(), capacity);
+    BOOST_CHECK_EQUAL(events.front().elements, 10);
+    BOOST_CHECK_EQUAL(events.back().elements, recorded - 1);
+    BOOST_CHECK_EQUAL(events.back().threadId, 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenGrowing_ThenEveryReallocationIsRecorded)
+{
+    const std::size_t before = countOf(HotPathEventKind::reallocation, "Vector");
+    aisdi::Vector<int> collection;
+    const std::size_t initialCapacity = collection.getCapacity();
+
+    for(std::size_t i = 0; i < 4 * initialCapacity; ++i)
+        collection.append(static_cast<int>(i));
+
+    const std::vector<HotPathEvent> events = eventsOf(HotPathEventKind::reallocation, "Vector");
+    BOOST_REQUIRE_EQUAL(events.size(), before + 2);
+    BOOST_CHECK_EQUAL(events.back().elements, 2 * initialCapacity);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenCopyingAndErasingRange_ThenBothAreRecorded)
+{
+    const std::size_t copies = countOf(HotPathEventKind::bulkCopy, "Vector");
+    aisdi::Vector<int> collection = { 1, 2, 3, 4, 5 };
+
+    aisdi::Vector<int> copy(collection);
+    copy.erase(copy.begin() + 1, copy.begin() + 4);
+
+    BOOST_CHECK_EQUAL(countOf(HotPathEventKind::bulkCopy, "Vector"), copies + 1);
+    BOOST_CHECK_EQUAL(eventsOf(HotPathEventKind::rangeErase, "Vector").back().elements, 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedList_WhenWalkingFar_ThenOnlyLongTraversalsAreRecorded)
+{
+    const std::size_t length = 3 * AISDI_LINEAR_HOT_PATH_MIN_TRAVERSAL;
+    aisdi::LinkedList<int> collection;
+    for(std::size_t i = 0; i < length; ++i)
+        collection.append(static_cast<int>(i));
+    const std::size_t before = countOf(HotPathEventKind::traversal, "LinkedList");
+
+    BOOST_CHECK_EQUAL(*(collection.begin() + 10), 10);
+    BOOST_CHECK_EQUAL(countOf(HotPathEventKind::traversal, "LinkedList"), before);
+    BOOST_CHECK_EQUAL(*(collection.begin() + length / 2), static_cast<int>(length / 2));
+
+    const std::vector<HotPathEvent> events = eventsOf(HotPathEventKind::traversal, "LinkedList");
+    BOOST_REQUIRE_EQUAL(events.size(), before + 1);
+    BOOST_CHECK_EQUAL(events.back().elements, length / 2 - 10); // from the finger left at 10
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedList_WhenErasingRangeAndDefragmenting_ThenBothAreRecorded)
+{
+    aisdi::LinkedList<int> collection = { 1, 2, 3, 4, 5, 6 };
+
+    collection.erase(collection.begin() + 1, collection.begin() + 3);
+    collection.defragment();
+
+    BOOST_CHECK_EQUAL(eventsOf(HotPathEventKind::rangeErase, "LinkedList").back().elements, 2);
+    BOOST_CHECK_EQUAL(eventsOf(HotPathEventKind::reallocation, "LinkedList").back().elements, 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoThreads_WhenBothRecord_ThenTheirEventsHaveDifferentThreads)
+{
+    aisdi::LinkedList<int> collection = { 1, 2, 3 };
+    aisdi::LinkedList<int> copy(collection);
+    std::uint32_t otherThread = 0;
+    std::thread other([&]
+    {
+        aisdi::LinkedList<int> otherCopy(collection);
+        otherThread = eventsOf(HotPathEventKind::bulkCopy, "LinkedList").back().threadId;
+    });
+    other.join();
+
+    const std::vector<HotPathEvent> events = eventsOf(HotPathEventKind::bulkCopy, "LinkedList");
+    BOOST_REQUIRE_GE(events.size(), 2);
+    BOOST_CHECK_NE(otherThread, 0);
+    BOOST_CHECK_NE(events[events.size() - 2].threadId, otherThread);
+    BOOST_CHECK_EQUAL(events.back().threadId, otherThread);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEvents_WhenWritingChromeTrace_ThenCompleteEventsAreWritten)
+{
+    const std::vector<HotPathEvent> events = {
+        HotPathEvent { HotPathEventKind::reallocation, "Vector", 1500, 250, 1024, 1 },
+        HotPathEvent { HotPathEventKind::traversal, "LinkedList", 2000, 1000000, 5000, 2 } };
+    std::ostringstream out;
+
+    aisdi::writeChromeTrace(out, events);
+
+    BOOST_CHECK_EQUAL(out.str(), "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n"
+                      "  {\"name\": \"Vector reallocation\", \"cat\": \"reallocation\", \"ph\": \"X\", \"pid\": 1, "
+                      "\"tid\": 1, \"ts\": 1.500, \"dur\": 0.250, \"args\": {\"elements\": 1024}},\n"
+                      "  {\"name\": \"LinkedList traversal\", \"cat\": \"traversal\", \"ph\": \"X\", \"pid\": 1, "
+                      "\"tid\": 2, \"ts\": 2.000, \"dur\": 1000.000, \"args\": {\"elements\": 5000}}\n"
+                      "]}\n");
+}
+
+BOOST_AUTO_TEST_CASE(GivenNoEvents_WhenWritingChromeTrace_ThenTraceIsEmpty)
+{
+    std::ostringstream out;
+
+    aisdi::writeChromeTrace(out, std::vector<HotPathEvent>());
+
+    BOOST_CHECK_EQUAL(out.str(), "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n]}\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
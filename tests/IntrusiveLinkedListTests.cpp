@@ -0,0 +1,337 @@
+#include <IntrusiveLinkedList.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using std::begin;
+using std::end;
+
+namespace
+{
+
+struct Task
+{
+    explicit Task(int initValue = 0) : value(initValue)
+    {}
+
+    int value;
+    aisdi::IntrusiveListHook queueHook;
+    aisdi::IntrusiveListHook allHook;
+};
+
+struct AutoTask
+{
+    explicit AutoTask(int initValue = 0) : value(initValue), hook(aisdi::IntrusiveListHook::autoUnlink)
+    {}
+
+    int value;
+    aisdi::IntrusiveListHook hook;
+};
+
+struct Job
+{
+    explicit Job(int initValue) : value(initValue)
+    {}
+
+    virtual ~Job()
+    {}
+
+    int value;
+};
+
+// not standard layout: virtual functions, members in both the base and the derived class
+struct LoggedJob : Job
+{
+    explicit LoggedJob(int initValue) : Job(initValue), log(initValue * 10)
+    {}
+
+    int log;
+    aisdi::IntrusiveListHook hook;
+};
+
+using Queue = aisdi::IntrusiveLinkedList<Task, &Task::queueHook>;
+using AllTasks = aisdi::IntrusiveLinkedList<Task, &Task::allHook>;
+using AutoQueue = aisdi::IntrusiveLinkedList<AutoTask, &AutoTask::hook>;
+using JobQueue = aisdi::IntrusiveLinkedList<LoggedJob, &LoggedJob::hook>;
+
+template <typename List>
+std::vector<int> valuesOf(const List& list)
+{
+    std::vector<int> values;
+    for(auto it = begin(list); it != end(list); ++it)
+        values.push_back(it->value);
+    return values;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(IntrusiveLinkedListTests)
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+    Queue queue;
+
+    BOOST_CHECK(queue.isEmpty());
+    BOOST_CHECK_EQUAL(queue.getSize(), 0);
+    BOOST_CHECK(begin(queue) == end(queue));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyList_WhenAppendingAndPrepending_ThenObjectsAreLinkedInOrder)
+{
+    Task a(1), b(2), c(3);
+    Queue queue;
+
+    queue.append(b);
+    queue.append(c);
+    queue.prepend(a);
+
+    std::vector<int> expected = { 1, 2, 3 };
+    auto values = valuesOf(queue);
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(values), end(values), begin(expected), end(expected));
+    BOOST_CHECK_EQUAL(queue.getSize(), 3);
+    BOOST_CHECK(a.queueHook.isLinked());
+    BOOST_CHECK(!a.allHook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenIterating_ThenObjectsAreNotCopied)
+{
+    Task a(1);
+    Queue queue;
+    queue.append(a);
+
+    BOOST_CHECK_EQUAL(&*begin(queue), &a);
+    (*begin(queue)).value = 5;
+    BOOST_CHECK_EQUAL(a.value, 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenInsertingInTheMiddle_ThenObjectIsLinkedBeforePosition)
+{
+    Task a(1), b(2), c(3);
+    Queue queue;
+    queue.append(a);
+    queue.append(c);
+
+    queue.insert(begin(queue) + 1, b);
+
+    std::vector<int> expected = { 1, 2, 3 };
+    auto values = valuesOf(queue);
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(values), end(values), begin(expected), end(expected));
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedObject_WhenAppendingItAgain_ThenExceptionIsThrown)
+{
+    Task a(1);
+    Queue queue, other;
+    queue.append(a);
+
+    BOOST_CHECK_THROW(queue.append(a), std::logic_error);
+    BOOST_CHECK_THROW(other.prepend(a), std::logic_error);
+    BOOST_CHECK_EQUAL(queue.getSize(), 1);
+    BOOST_CHECK(other.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenObjectInTwoLists_WhenErasingFromOne_ThenItStaysInTheOther)
+{
+    Task a(1), b(2);
+    Queue queue;
+    AllTasks all;
+    queue.append(a);
+    queue.append(b);
+    all.append(a);
+    all.append(b);
+
+    queue.erase(a);
+
+    BOOST_CHECK_EQUAL(queue.getSize(), 1);
+    BOOST_CHECK_EQUAL(all.getSize(), 2);
+    BOOST_CHECK(!queue.contains(a));
+    BOOST_CHECK(all.contains(a));
+    BOOST_CHECK_EQUAL(begin(all)->value, 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenObjectOutsideList_WhenErasingByReference_ThenExceptionIsThrown)
+{
+    Task a(1), b(2);
+    Queue queue, other;
+    queue.append(a);
+    other.append(b);
+
+    BOOST_CHECK_THROW(queue.erase(b), std::invalid_argument);
+    BOOST_CHECK_THROW(queue.iteratorTo(b), std::invalid_argument);
+    BOOST_CHECK_EQUAL(other.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenObjectInTheMiddle_WhenUnlinkingThroughHook_ThenNeighboursAreJoined)
+{
+    Task a(1), b(2), c(3);
+    Queue queue;
+    queue.append(a);
+    queue.append(b);
+    queue.append(c);
+
+    b.queueHook.unlink();
+    b.queueHook.unlink();
+
+    std::vector<int> expected = { 1, 3 };
+    auto values = valuesOf(queue);
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(values), end(values), begin(expected), end(expected));
+    BOOST_CHECK_EQUAL(queue.getSize(), 2);
+    BOOST_CHECK(!b.queueHook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoQueues_WhenMovingObjectBetweenThem_ThenItIsLinkedOnlyInTarget)
+{
+    Task a(1), b(2);
+    Queue ready, blocked;
+    ready.append(a);
+    ready.append(b);
+
+    blocked.append(ready.popFirst());
+
+    BOOST_CHECK_EQUAL(ready.getSize(), 1);
+    BOOST_CHECK_EQUAL(blocked.getSize(), 1);
+    BOOST_CHECK_EQUAL(&*begin(blocked), &a);
+    BOOST_CHECK_EQUAL(&ready.popLast(), &b);
+    BOOST_CHECK(ready.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyList_WhenPopping_ThenExceptionIsThrown)
+{
+    Queue queue;
+
+    BOOST_CHECK_THROW(queue.popFirst(), std::logic_error);
+    BOOST_CHECK_THROW(queue.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenErasingEnd_ThenExceptionIsThrown)
+{
+    Task a(1);
+    Queue queue;
+    queue.append(a);
+
+    BOOST_CHECK_THROW(queue.erase(end(queue)), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIteratorOfAnotherList_WhenErasing_ThenExceptionIsThrown)
+{
+    Task a(1), b(2);
+    Queue queue, other;
+    queue.append(a);
+    other.append(b);
+
+    BOOST_CHECK_THROW(queue.erase(begin(other)), std::invalid_argument);
+    BOOST_CHECK_THROW(queue.erase(end(other)), std::invalid_argument);
+    BOOST_CHECK(b.queueHook.isLinked());
+    BOOST_CHECK_EQUAL(queue.getSize(), 1);
+    BOOST_CHECK_EQUAL(other.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenObjectsWithoutStandardLayout_WhenIteratingAndPopping_ThenObjectsAreFound)
+{
+    LoggedJob a(1), b(2);
+    JobQueue queue;
+    queue.append(a);
+    queue.prepend(b);
+
+    BOOST_CHECK_EQUAL(&*begin(queue), &b);
+    BOOST_CHECK_EQUAL(begin(queue)->log, 20);
+    BOOST_CHECK_EQUAL((begin(queue) + 1)->value, 1);
+    BOOST_CHECK_EQUAL(&queue.popLast(), &a);
+    BOOST_CHECK_EQUAL(&queue.popFirst(), &b);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenErasingRange_ThenOnlyObjectsInRangeAreUnlinked)
+{
+    Task tasks[5] = { Task(0), Task(1), Task(2), Task(3), Task(4) };
+    Queue queue;
+    for(auto& task : tasks)
+        queue.append(task);
+
+    queue.erase(begin(queue) + 1, begin(queue) + 4);
+
+    std::vector<int> expected = { 0, 4 };
+    auto values = valuesOf(queue);
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(values), end(values), begin(expected), end(expected));
+    BOOST_CHECK(!tasks[2].queueHook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenObject_WhenTakingIteratorTo_ThenIteratorPointsAtIt)
+{
+    Task a(1), b(2), c(3);
+    Queue queue;
+    queue.append(a);
+    queue.append(b);
+    queue.append(c);
+
+    auto it = queue.iteratorTo(b);
+
+    BOOST_CHECK_EQUAL(&*it, &b);
+    BOOST_CHECK_EQUAL(&*--it, &a);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenMovingIteratorsBeyondBounds_ThenExceptionsAreThrown)
+{
+    Task a(1);
+    Queue queue;
+    queue.append(a);
+
+    BOOST_CHECK_THROW(*end(queue), std::out_of_range);
+    BOOST_CHECK_THROW(++end(queue), std::out_of_range);
+    BOOST_CHECK_THROW(--begin(queue), std::out_of_range);
+    BOOST_CHECK_THROW(begin(queue) + 2, std::range_error);
+    BOOST_CHECK(end(queue) - 5 == begin(queue));
+}
+
+BOOST_AUTO_TEST_CASE(GivenAutoUnlinkingObject_WhenItIsDestroyed_ThenItLeavesTheList)
+{
+    AutoTask a(1), c(3);
+    AutoQueue queue;
+    queue.append(a);
+    {
+        AutoTask b(2);
+        queue.append(b);
+        queue.append(c);
+    }
+
+    std::vector<int> expected = { 1, 3 };
+    auto values = valuesOf(queue);
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(values), end(values), begin(expected), end(expected));
+    BOOST_CHECK_EQUAL(queue.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedObject_WhenCopyingIt_ThenCopyIsNotLinked)
+{
+    Task a(1);
+    Queue queue;
+    queue.append(a);
+
+    Task copy(a);
+    Task assigned(7);
+    assigned = a;
+
+    BOOST_CHECK(!copy.queueHook.isLinked());
+    BOOST_CHECK(!assigned.queueHook.isLinked());
+    BOOST_CHECK_EQUAL(assigned.value, 1);
+    BOOST_CHECK_EQUAL(queue.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenItIsDestroyed_ThenObjectsAreUnlinked)
+{
+    Task a(1), b(2);
+    {
+        Queue queue;
+        queue.append(a);
+        queue.append(b);
+    }
+
+    BOOST_CHECK(!a.queueHook.isLinked());
+    BOOST_CHECK(!b.queueHook.isLinked());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
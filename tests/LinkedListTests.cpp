@@ -4,6 +4,12 @@
 #include <complex>
 #include <cstdint>
 #include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/test_tools.hpp>
@@ -130,19 +136,28 @@ struct Fixture
 
 template <typename T>
 using LinearCollection = aisdi::LinkedList<T>;
+template <typename T>
+using HashedCollection = aisdi::LinkedList<T, aisdi::InlinePayload, aisdi::HashValueIndex<>>;
 
 using TestedTypes = boost::mpl::list<std::int32_t,
       std::uint64_t,
       std::complex<std::int32_t>,
       OperationCountingObject>;
 
+using OrderedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t,
+      OperationCountingObject>;
+
+using HashableTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t>;
+
 using std::begin;
 using std::end;
 
-BOOST_FIXTURE_TEST_SUITE(VectorTests, Fixture)
+BOOST_FIXTURE_TEST_SUITE(LinkedListTests, Fixture)
 
-template <typename T>
-void thenCollectionContainsValues(const LinearCollection<T>& collection,
+template <typename T, typename Payload, typename Lookup>
+void thenCollectionContainsValues(const aisdi::LinkedList<T, Payload, Lookup>& collection,
                                   std::initializer_list<int> expected)
 {
     BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
@@ -929,6 +944,1176 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
     BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoCollections_WhenSplicingWholeList_ThenNodesAreMovedWithoutCopying,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 5 };
+    LinearCollection<T> other = { 3, 4 };
+    OperationCountingObject::resetCounters();
+
+    collection.splice(begin(collection) + 2, other);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5 });
+    BOOST_CHECK_EQUAL(collection.getSize(), 5);
+    BOOST_CHECK(other.isEmpty());
+    BOOST_CHECK(begin(other) == end(other));
+    thenCopiedObjectsCountWas<T>(0);
+    thenConstructedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenSplicingWholeList_ThenItemsAreMoved,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection;
+    LinearCollection<T> other = { 3, 4 };
+
+    collection.splice(end(collection), other);
+
+    thenCollectionContainsValues(collection, { 3, 4 });
+    BOOST_CHECK_EQUAL(*(end(collection) - 1), 4);
+    BOOST_CHECK(other.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSplicingIntoItself_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2 };
+
+    BOOST_CHECK_THROW(collection.splice(begin(collection), collection), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoCollections_WhenSplicingRange_ThenOnlyRangeIsMoved,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 5 };
+    LinearCollection<T> other = { 10, 2, 3, 4, 11 };
+    OperationCountingObject::resetCounters();
+
+    collection.splice(begin(collection) + 1, other, begin(other) + 1, end(other) - 1);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5 });
+    thenCollectionContainsValues(other, { 10, 11 });
+    BOOST_CHECK_EQUAL(collection.getSize(), 5);
+    BOOST_CHECK_EQUAL(other.getSize(), 2);
+    thenCopiedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSplicingRangeWithinIt_ThenItemsAreReordered,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 3, 4, 1, 2 };
+
+    collection.splice(begin(collection), collection, begin(collection) + 2, end(collection));
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+    BOOST_CHECK_EQUAL(collection.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenSplittingInTheMiddle_ThenTailIsReturned,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+    OperationCountingObject::resetCounters();
+
+    auto tail = collection.splitAt(begin(collection) + 2);
+
+    thenCollectionContainsValues(collection, { 1, 2 });
+    thenCollectionContainsValues(tail, { 3, 4, 5 });
+    BOOST_CHECK_EQUAL(collection.getSize(), 2);
+    BOOST_CHECK_EQUAL(tail.getSize(), 3);
+    thenCopiedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenSplittingAtEnds_ThenOneOfListsIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3 };
+
+    auto emptyTail = collection.splitAt(end(collection));
+    auto wholeTail = collection.splitAt(begin(collection));
+
+    BOOST_CHECK(emptyTail.isEmpty());
+    BOOST_CHECK(collection.isEmpty());
+    BOOST_CHECK(begin(collection) == end(collection));
+    thenCollectionContainsValues(wholeTail, { 1, 2, 3 });
+    BOOST_CHECK_EQUAL(wholeTail.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSplitCollection_WhenAppendingToBothParts_ThenPartsStayIndependent,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3, 4 };
+
+    auto tail = collection.splitAt(end(collection) - 1);
+    collection.append(10);
+    tail.prepend(20);
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 10 });
+    thenCollectionContainsValues(tail, { 20, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTwoSortedCollections_WhenMerging_ThenResultIsSortedAndNothingIsCopied,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 1, 4, 4, 9 };
+    LinearCollection<T> other = { 0, 2, 3, 4, 10, 11 };
+    OperationCountingObject::resetCounters();
+
+    collection.mergeSorted(other);
+
+    thenCollectionContainsValues(collection, { 0, 1, 2, 3, 4, 4, 4, 9, 10, 11 });
+    BOOST_CHECK_EQUAL(collection.getSize(), 10);
+    BOOST_CHECK(other.isEmpty());
+    thenCopiedObjectsCountWas<T>(0);
+    thenConstructedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenMergingSortedList_ThenItemsAreMoved,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection;
+    LinearCollection<T> other = { 1, 2 };
+
+    collection.mergeSorted(other);
+
+    thenCollectionContainsValues(collection, { 1, 2 });
+    BOOST_CHECK(other.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenComparator_WhenMerging_ThenItDefinesTheOrder,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 9, 5, 1 };
+    LinearCollection<T> other = { 8, 5, 0 };
+
+    collection.mergeSorted(other, [](const T& a, const T& b) { return b < a; });
+
+    thenCollectionContainsValues(collection, { 9, 8, 5, 5, 1, 0 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenUnsortedCollection_WhenSorting_ThenItemsAreOrderedAndNothingIsCopied,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 5, 1, 4, 4, 9, 0, 7, 2, 8, 3, 6 };
+    OperationCountingObject::resetCounters();
+
+    collection.sort();
+
+    thenCollectionContainsValues(collection, { 0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9 });
+    BOOST_CHECK_EQUAL(collection.getSize(), 11);
+    BOOST_CHECK_EQUAL(*(end(collection) - 1), 9);
+    thenCopiedObjectsCountWas<T>(0);
+    thenConstructedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenDescendingCollection_WhenSorting_ThenItemsAreOrdered,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 6, 5, 4, 3, 2, 1 };
+
+    collection.sort();
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSortedCollection_WhenSortingWithComparator_ThenOrderIsReversed,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3, 3, 5 };
+
+    collection.sort([](const T& a, const T& b) { return b < a; });
+
+    thenCollectionContainsValues(collection, { 5, 3, 3, 2, 1 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSorting_ThenIteratorsStillPointToTheirItems,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 3, 1, 2 };
+    auto it = begin(collection);
+
+    collection.sort();
+
+    BOOST_CHECK_EQUAL(*it, 3);
+    BOOST_CHECK(++it == end(collection));
+    BOOST_CHECK_EQUAL(*--it, 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualKeys_WhenSorting_ThenOriginalOrderIsKept)
+{
+    LinearCollection<std::pair<int, int>> collection;
+    for(int i = 0; i < 100; ++i)
+        collection.append(std::make_pair((i * 7) % 5, i));
+
+    collection.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+
+    std::size_t unstable = 0;
+    for(auto it = begin(collection); it + 1 != end(collection); ++it)
+        unstable += (*it).first > (*(it + 1)).first
+            || ((*it).first == (*(it + 1)).first && (*it).second > (*(it + 1)).second);
+    BOOST_CHECK_EQUAL(unstable, 0);
+    BOOST_CHECK_EQUAL(collection.getSize(), 100);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIndexedCollection_WhenAddingIntegerToIterator_ThenItemAtPositionIsReturned,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection;
+    collection.enablePositionalIndex();
+    for(int i = 0; i < 100; ++i)
+        collection.append(i);
+
+    BOOST_CHECK(collection.hasPositionalIndex());
+    BOOST_CHECK_EQUAL(*(begin(collection) + 42), 42);
+    BOOST_CHECK_EQUAL(*(begin(collection) + 10 + 30), 40);
+    BOOST_CHECK_EQUAL(*(end(collection) - 1), 99);
+    BOOST_CHECK_EQUAL(*(end(collection) - 100), 0);
+    BOOST_CHECK(begin(collection) + 100 == end(collection));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIndexedCollection_WhenMovingIteratorBeyondEnd_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3 };
+    collection.enablePositionalIndex();
+
+    BOOST_CHECK_THROW(begin(collection) + 4, std::range_error);
+    BOOST_CHECK_THROW(collection.cbegin() + 4, std::range_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenGettingIndexOfIterator_ThenPositionIsReturned,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 10, 20, 30, 40, 50 };
+    LinearCollection<T> indexed = collection;
+    indexed.enablePositionalIndex();
+
+    BOOST_CHECK_EQUAL(collection.indexOf(begin(collection)), 0);
+    BOOST_CHECK_EQUAL(collection.indexOf(begin(collection) + 3), 3);
+    BOOST_CHECK_EQUAL(collection.indexOf(end(collection)), 5);
+    BOOST_CHECK_EQUAL(indexed.indexOf(begin(indexed)), 0);
+    BOOST_CHECK_EQUAL(indexed.indexOf(++begin(indexed)), 1);
+    BOOST_CHECK_EQUAL(indexed.indexOf(--end(indexed)), 4);
+    BOOST_CHECK_EQUAL(indexed.indexOf(end(indexed)), 5);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAtPosition_ThenItemIsPlacedThere,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 3 };
+    LinearCollection<T> indexed = collection;
+    indexed.enablePositionalIndex();
+
+    collection.insertAt(1, 2);
+    collection.insertAt(3, 4);
+    collection.insertAt(0, 0);
+    indexed.insertAt(1, 2);
+    indexed.insertAt(3, 4);
+    indexed.insertAt(0, 0);
+
+    thenCollectionContainsValues(collection, { 0, 1, 2, 3, 4 });
+    thenCollectionContainsValues(indexed, { 0, 1, 2, 3, 4 });
+    BOOST_CHECK_EQUAL(indexed.indexOf(end(indexed) - 1), 4);
+    BOOST_CHECK_THROW(collection.insertAt(6, 0), std::out_of_range);
+    BOOST_CHECK_THROW(indexed.insertAt(6, 0), std::out_of_range);
+}
+
+void whenMutatingRandomly(LinearCollection<int>& collection, std::vector<int>& expected)
+{
+    std::uint32_t state = 2024;
+    auto random = [&state](std::size_t bound)
+    {
+        state = state * 1103515245u + 12345u;
+        return static_cast<std::size_t>(state >> 8) % bound;
+    };
+
+    for(int i = 0; i < 4000; ++i)
+    {
+        std::size_t operation = random(8);
+        std::size_t position = random(expected.size() + 1);
+        if(operation == 0)
+        {
+            collection.append(i);
+            expected.push_back(i);
+        }
+        else if(operation == 1)
+        {
+            collection.prepend(i);
+            expected.insert(expected.begin(), i);
+        }
+        else if(operation == 2)
+        {
+            collection.insert(begin(collection) + position, i);
+            expected.insert(expected.begin() + position, i);
+        }
+        else if(operation == 3)
+        {
+            collection.insertAt(position, i);
+            expected.insert(expected.begin() + position, i);
+        }
+        else if(operation == 4 && position < expected.size())
+        {
+            BOOST_REQUIRE_EQUAL(*(begin(collection) + position), expected[position]);
+        }
+        else if(!expected.empty())
+        {
+            position = position == expected.size() ? position - 1 : position;
+            collection.erase(begin(collection) + position);
+            expected.erase(expected.begin() + position);
+        }
+    }
+}
+
+void thenPositionalAccessMatches(const LinearCollection<int>& collection, const std::vector<int>& expected)
+{
+    BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+    std::size_t wrongItems = 0, wrongIndices = 0;
+    auto it = begin(collection);
+    for(std::size_t i = 0; i < expected.size(); ++i, ++it)
+    {
+        wrongItems += *(begin(collection) + i) != expected[i];
+        wrongIndices += collection.indexOf(it) != i;
+    }
+    for(std::size_t i = expected.size(); i-- > 0; )
+        wrongItems += *(end(collection) - (expected.size() - i)) != expected[i];
+    BOOST_CHECK_EQUAL(wrongItems, 0);
+    BOOST_CHECK_EQUAL(wrongIndices, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIndexedCollection_WhenMutatingRandomly_ThenPositionsStayConsistent)
+{
+    LinearCollection<int> collection;
+    collection.enablePositionalIndex();
+    std::vector<int> expected;
+
+    whenMutatingRandomly(collection, expected);
+
+    thenPositionalAccessMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenMutatingRandomlyBetweenPositionalReads_ThenFingerStaysConsistent)
+{
+    LinearCollection<int> collection;
+    std::vector<int> expected;
+
+    whenMutatingRandomly(collection, expected);
+
+    thenPositionalAccessMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenPositionalRead_WhenErasingAroundIt_ThenNextReadsAreCorrect,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    auto it = begin(collection) + 4;
+    collection.erase(it - 1);
+    collection.erase(begin(collection) + 3);
+    collection.erase(begin(collection));
+
+    thenCollectionContainsValues(collection, { 1, 2, 5, 6, 7 });
+    BOOST_CHECK_EQUAL(*(begin(collection) + 2), 5);
+    BOOST_CHECK_EQUAL(*(begin(collection) + 3), 6);
+    BOOST_CHECK_EQUAL(collection.indexOf(end(collection) - 1), 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenPositionalRead_WhenInsertingAroundIt_ThenNextReadsAreCorrect,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 0, 1, 2, 3, 4 };
+
+    auto it = begin(collection) + 2;
+    collection.insert(it, 10);
+    collection.insert(it + 1, 20);
+    collection.prepend(30);
+
+    thenCollectionContainsValues(collection, { 30, 0, 1, 10, 2, 20, 3, 4 });
+    BOOST_CHECK_EQUAL(*(begin(collection) + 4), 2);
+    BOOST_CHECK_EQUAL(*(begin(collection) + 5), 20);
+    BOOST_CHECK_EQUAL(collection.indexOf(it), 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIndexedCollections_WhenRelinkingInBulk_ThenPositionsStayConsistent,
+                              T,
+                              OrderedTypes)
+{
+    LinearCollection<T> collection = { 9, 7, 5 };
+    LinearCollection<T> other = { 8, 6, 4 };
+    collection.enablePositionalIndex();
+    other.enablePositionalIndex();
+
+    collection.splice(end(collection), other, begin(other), begin(other) + 2);
+    collection.sort();
+    auto tail = collection.splitAt(begin(collection) + 3);
+
+    thenCollectionContainsValues(collection, { 5, 6, 7 });
+    thenCollectionContainsValues(other, { 4 });
+    BOOST_CHECK_EQUAL(*(begin(collection) + 2), 7);
+    BOOST_CHECK_EQUAL(collection.indexOf(end(collection) - 1), 2);
+    BOOST_CHECK_EQUAL(*(begin(other) + 0), 4);
+    BOOST_CHECK(!tail.hasPositionalIndex());
+    thenCollectionContainsValues(tail, { 8, 9 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenIteratorSplicedToAnotherCollection_WhenJumping_ThenItMovesWithinItsNewCollection)
+{
+    LinearCollection<int> collection = { -1, -2 };
+    LinearCollection<int> other;
+    for(int i = 0; i < 100; ++i)
+        other.append(i);
+    collection.enablePositionalIndex();
+    other.enablePositionalIndex();
+    auto it = begin(other) + 10;
+
+    collection.splice(end(collection), other, begin(other) + 5, begin(other) + 50);
+
+    BOOST_CHECK_EQUAL(*(it + 5), 15);
+    BOOST_CHECK_EQUAL(*(it - 3), 7);
+    BOOST_CHECK(it + 40 == end(collection));
+    BOOST_CHECK_THROW(it + 41, std::range_error);
+    BOOST_CHECK_EQUAL(*(it - 100), -1);
+    BOOST_CHECK_EQUAL(*(begin(other) + 5), 50);
+}
+
+template <typename T>
+void whenChurning(LinearCollection<T>& collection)
+{
+    for(int i = 0; i < 6; ++i)
+        collection.append(i);
+    collection.erase(begin(collection) + 1);
+    collection.prepend(10);
+    collection.insert(begin(collection) + 3, 20);
+    collection.erase(end(collection) - 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenChurnedCollection_WhenDefragmenting_ThenItemsAndOrderAreKept,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection;
+    whenChurning(collection);
+
+    collection.defragment();
+
+    thenCollectionContainsValues(collection, { 10, 0, 2, 20, 3, 5 });
+    collection.append(6);
+    collection.erase(begin(collection));
+    thenCollectionContainsValues(collection, { 0, 2, 20, 3, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenChurnedCollection_WhenDefragmenting_ThenNodesFollowListOrderInMemory)
+{
+    LinearCollection<int> collection;
+    whenChurning(collection);
+
+    collection.defragment();
+
+    auto it = begin(collection);
+    const char * previous = reinterpret_cast<const char *>(&*it);
+    const char * current = reinterpret_cast<const char *>(&*++it);
+    std::ptrdiff_t stride = current - previous;
+    std::size_t irregular = 0;
+    for(++it; it != end(collection); ++it)
+    {
+        previous = current;
+        current = reinterpret_cast<const char *>(&*it);
+        irregular += current - previous != stride;
+    }
+    BOOST_CHECK(stride > 0);
+    BOOST_CHECK_EQUAL(irregular, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenDefragmentingIncrementally_ThenPassEndsAfterAllNodes,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+
+    BOOST_CHECK(!collection.defragment(2));
+    BOOST_CHECK(!collection.defragment(2));
+    BOOST_CHECK(collection.defragment(2));
+
+    thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5 });
+    BOOST_CHECK_THROW(collection.defragment(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalPass_WhenErasingNodeItContinuesFrom_ThenPassGoesOnAfterIt,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+
+    BOOST_CHECK(!collection.defragment(2));
+    collection.erase(begin(collection) + 2);
+    collection.erase(begin(collection));
+    BOOST_CHECK(collection.defragment(2));
+
+    thenCollectionContainsValues(collection, { 2, 4, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenIndexedCollection_WhenDefragmenting_ThenPositionsStayConsistent)
+{
+    LinearCollection<int> collection;
+    std::vector<int> expected;
+    collection.enablePositionalIndex();
+    whenMutatingRandomly(collection, expected);
+
+    while(!collection.defragment(100))
+        BOOST_REQUIRE_EQUAL(*(begin(collection) + expected.size() / 2), expected[expected.size() / 2]);
+
+    thenPositionalAccessMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPositionalRead_WhenDefragmenting_ThenFingerFollowsItsNode)
+{
+    LinearCollection<int> collection = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    BOOST_CHECK_EQUAL(*(begin(collection) + 5), 5);
+
+    collection.defragment();
+
+    BOOST_CHECK_EQUAL(*(begin(collection) + 6), 6);
+    BOOST_CHECK_EQUAL(collection.indexOf(begin(collection) + 4), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenDefragmentedCollection_WhenItsNodesAreSplicedAndDestroyedElsewhere_ThenAllItemsAreDestroyed)
+{
+    {
+        LinearCollection<OperationCountingObject> collection = { 1, 2, 3, 4, 5 };
+        collection.defragment();
+        LinearCollection<OperationCountingObject> other = { 6 };
+        other.splice(end(other), collection, begin(collection) + 1, begin(collection) + 3);
+        auto tail = collection.splitAt(begin(collection) + 1);
+        {
+            LinearCollection<OperationCountingObject> moved(std::move(tail));
+            moved.erase(begin(moved));
+        }
+        other.erase(begin(other) + 1);
+        thenCollectionContainsValues(other, { 6, 3 });
+        thenCollectionContainsValues(collection, { 1 });
+    }
+
+    BOOST_CHECK_EQUAL(OperationCountingObject::constructedObjectsCount(),
+                      OperationCountingObject::destroyedObjectsCount());
+}
+
+BOOST_AUTO_TEST_CASE(GivenDefragmentedCollections_WhenMergingAndSplicingTheirNodesBack_ThenAllItemsAreDestroyed)
+{
+    {
+        LinearCollection<OperationCountingObject> collection = { 1, 3, 5 };
+        LinearCollection<OperationCountingObject> other = { 2, 4, 6 };
+        collection.defragment();
+        other.defragment();
+
+        collection.mergeSorted(other);
+        other.splice(end(other), collection, begin(collection) + 1, begin(collection) + 4);
+        collection.defragment();
+        other.append(7);
+        other.erase(begin(other));
+
+        thenCollectionContainsValues(collection, { 1, 5, 6 });
+        thenCollectionContainsValues(other, { 3, 4, 7 });
+    }
+
+    BOOST_CHECK_EQUAL(OperationCountingObject::constructedObjectsCount(),
+                      OperationCountingObject::destroyedObjectsCount());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSlabSharedByCollectionsOnTwoThreads_WhenBothEraseTheirItems_ThenAllItemsAreDestroyed)
+{
+    auto token = std::make_shared<int>(0);
+    {
+        LinearCollection<std::shared_ptr<int>> collection;
+        for(int i = 0; i < 2000; ++i)
+            collection.append(token);
+        collection.defragment();
+        auto tail = collection.splitAt(begin(collection) + 1000);
+        collection.append(token);
+
+        std::thread other([&tail]
+        {
+            while(!tail.isEmpty())
+                tail.popFirst();
+        });
+        while(!collection.isEmpty())
+            collection.popLast();
+        other.join();
+    }
+
+    BOOST_CHECK_EQUAL(token.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenVisitingWithForEach_ThenItemsAreVisitedInOrder,
+                              T,
+                              TestedTypes)
+{
+    const LinearCollection<T> collection = { 1, 2, 3, 4, 5, 6 };
+
+    for(std::size_t distance : { 0, 1, 4, 100 })
+    {
+        std::vector<T> visited;
+        collection.forEach([&visited](const T& item) { visited.push_back(item); }, distance);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(begin(visited), end(visited), begin(collection), end(collection));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenVisitingWithForEach_ThenFunctionIsNotCalled)
+{
+    LinearCollection<int> collection;
+    std::size_t calls = 0;
+
+    collection.forEach([&calls](int&) { ++calls; });
+
+    BOOST_CHECK_EQUAL(calls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenModifyingItemsInForEach_ThenItemsAreChanged)
+{
+    LinearCollection<int> collection = { 1, 2, 3 };
+
+    collection.forEach([](int& item) { item *= 10; });
+
+    thenCollectionContainsValues(collection, { 10, 20, 30 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenOutOfLinePayload_WhenMutatingAndRelinking_ThenCollectionBehavesTheSame)
+{
+    using OutOfLineCollection = aisdi::LinkedList<OperationCountingObject, aisdi::OutOfLinePayload>;
+    {
+        OutOfLineCollection collection = { 5, 1, 4 };
+        OutOfLineCollection other = { 3, 2 };
+        collection.append(7);
+        collection.prepend(9);
+        collection.insert(begin(collection) + 2, 6);
+        collection.erase(end(collection) - 1);
+        thenCollectionContainsValues(collection, { 9, 5, 6, 1, 4 });
+
+        collection.splice(end(collection), other);
+        collection.sort();
+        thenCollectionContainsValues(collection, { 1, 2, 3, 4, 5, 6, 9 });
+        BOOST_CHECK_EQUAL(collection.popLast(), 9);
+
+        const OperationCountingObject * third = &*(begin(collection) + 2);
+        std::size_t copied = OperationCountingObject::copiedObjectsCount();
+        collection.defragment();
+        BOOST_CHECK_EQUAL(&*(begin(collection) + 2), third);
+        BOOST_CHECK_EQUAL(OperationCountingObject::copiedObjectsCount(), copied);
+
+        int sum = 0;
+        collection.forEach([&sum](const OperationCountingObject& item) { sum += item; });
+        BOOST_CHECK_EQUAL(sum, 21);
+
+        OutOfLineCollection copy(collection);
+        thenCollectionContainsValues(copy, { 1, 2, 3, 4, 5, 6 });
+    }
+
+    BOOST_CHECK_EQUAL(OperationCountingObject::constructedObjectsCount(),
+                      OperationCountingObject::destroyedObjectsCount());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenValueIndexedCollection_WhenFindingValues_ThenTheirItemsAreFound,
+                              T,
+                              HashableTypes)
+{
+    HashedCollection<T> collection = { 4, 8, 15, 16, 23, 42 };
+
+    auto found = collection.find(15);
+
+    BOOST_REQUIRE(found != collection.end());
+    BOOST_CHECK_EQUAL(*found, T(15));
+    BOOST_CHECK_EQUAL(*(++found), T(16));
+    BOOST_CHECK(collection.find(7) == collection.end());
+    BOOST_CHECK(collection.contains(42));
+    BOOST_CHECK(!collection.contains(43));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenValueIndexedCollection_WhenErasingValues_ThenTheyAreGone,
+                              T,
+                              HashableTypes)
+{
+    HashedCollection<T> collection = { 4, 8, 15, 16, 23, 42 };
+
+    BOOST_CHECK(collection.eraseValue(15));
+    BOOST_CHECK(collection.eraseValue(4));
+    BOOST_CHECK(!collection.eraseValue(15));
+
+    thenCollectionContainsValues(collection, { 8, 16, 23, 42 });
+    BOOST_CHECK(!collection.contains(15));
+}
+
+// changing an item in place would leave the index under its old value, so items are handed out as const
+BOOST_AUTO_TEST_CASE(GivenValueIndexedCollection_WhenAccessingItems_ThenTheyAreConst)
+{
+    HashedCollection<int> collection = { 1, 2, 3 };
+    LinearCollection<int> plain = { 1, 2, 3 };
+    const bool hashedItemsAreConst = std::is_same<decltype(*collection.begin()), const int&>::value;
+    const bool plainItemsAreMutable = std::is_same<decltype(*plain.begin()), int&>::value;
+    std::vector<int> visited;
+
+    collection.forEach([&visited](const int& item) { visited.push_back(item); });
+    collection.erase(collection.begin());
+    collection.defragment();
+
+    BOOST_CHECK(hashedItemsAreConst);
+    BOOST_CHECK(plainItemsAreMutable);
+    BOOST_CHECK((std::is_same<HashedCollection<int>::iterator::reference, const int&>::value));
+    BOOST_CHECK_EQUAL(visited.size(), 3);
+    BOOST_CHECK(collection.eraseValue(2));
+    BOOST_CHECK(collection.eraseValue(3));
+    BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualItems_WhenErasingValueRepeatedly_ThenEachOneIsErasedOnce)
+{
+    HashedCollection<int> collection = { 1, 2, 1, 3, 1 };
+
+    BOOST_CHECK(collection.eraseValue(1));
+    BOOST_CHECK(collection.eraseValue(1));
+    BOOST_CHECK(collection.contains(1));
+    BOOST_CHECK(collection.eraseValue(1));
+    BOOST_CHECK(!collection.eraseValue(1));
+
+    thenCollectionContainsValues(collection, { 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualItems_WhenErasingThemByIterator_ThenIndexFollows)
+{
+    HashedCollection<int> collection = { 1, 1, 2, 1, 1 };
+
+    collection.erase(collection.begin() + 3);
+    collection.erase(collection.begin());
+    collection.popLast();
+
+    BOOST_REQUIRE(collection.find(1) != collection.end());
+    BOOST_CHECK(collection.find(1) == collection.begin());
+    BOOST_CHECK(collection.eraseValue(1));
+    BOOST_CHECK(!collection.contains(1));
+    thenCollectionContainsValues(collection, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenValueIndexedCollections_WhenSplicing_ThenValuesMoveWithTheirNodes)
+{
+    HashedCollection<int> collection = { 1, 2, 3 };
+    HashedCollection<int> other = { 4, 5, 6, 7 };
+
+    collection.splice(collection.end(), other, other.begin() + 1, other.begin() + 3);
+    BOOST_CHECK(collection.contains(5));
+    BOOST_CHECK(!other.contains(5));
+    BOOST_CHECK(other.contains(7));
+
+    collection.splice(collection.begin(), other);
+    BOOST_CHECK(collection.contains(7));
+    BOOST_CHECK(!other.contains(4));
+
+    BOOST_CHECK(collection.eraseValue(4));
+    BOOST_CHECK(collection.eraseValue(6));
+    thenCollectionContainsValues(collection, { 7, 1, 2, 3, 5 });
+    BOOST_CHECK(other.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenValueIndexedCollection_WhenSplittingAndMerging_ThenIndexFollows)
+{
+    HashedCollection<int> collection = { 1, 3, 5, 2, 4, 6 };
+
+    HashedCollection<int> tail = collection.splitAt(collection.begin() + 3);
+    BOOST_CHECK(!collection.contains(2));
+    BOOST_CHECK(tail.contains(2));
+
+    collection.mergeSorted(tail);
+    BOOST_CHECK(collection.contains(2));
+    BOOST_CHECK(!tail.contains(2));
+
+    collection.sort();
+    BOOST_CHECK(collection.eraseValue(4));
+    thenCollectionContainsValues(collection, { 1, 2, 3, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenValueIndexedCollection_WhenDefragmenting_ThenFoundIteratorsPointToNewNodes)
+{
+    HashedCollection<int> collection;
+    for(int i = 0; i < 100; ++i)
+        collection.append(i % 10);
+
+    collection.defragment();
+
+    for(int i = 0; i < 100; ++i)
+    {
+        BOOST_REQUIRE(collection.find(i % 10) != collection.end());
+        BOOST_CHECK_EQUAL(*collection.find(i % 10), i % 10);
+        BOOST_CHECK(collection.eraseValue(i % 10));
+    }
+    BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenValueIndexedCollection_WhenMoved_ThenIndexMovesAlong)
+{
+    HashedCollection<int> source = { 1, 2, 3 };
+
+    HashedCollection<int> collection(std::move(source));
+    BOOST_CHECK(collection.contains(2));
+
+    HashedCollection<int> assigned = { 9 };
+    assigned = std::move(collection);
+    BOOST_CHECK(assigned.eraseValue(2));
+    BOOST_CHECK(!assigned.contains(9));
+    thenCollectionContainsValues(assigned, { 1, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenValueIndexedCollection_WhenChurning_ThenIndexAgreesWithItems)
+{
+    HashedCollection<int> collection;
+    std::vector<int> expectedCounts(64, 0);
+    std::uint32_t state = 2463534242u;
+
+    for(int step = 0; step < 5000; ++step)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int value = static_cast<int>(state % 64);
+        if(state & 0x100)
+        {
+            collection.append(value);
+            ++expectedCounts[value];
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL(collection.eraseValue(value), expectedCounts[value] > 0);
+            if(expectedCounts[value] > 0)
+                --expectedCounts[value];
+        }
+    }
+
+    for(int value = 0; value < 64; ++value)
+    {
+        BOOST_CHECK_EQUAL(collection.contains(value), expectedCounts[value] > 0);
+        int counted = 0;
+        for(auto it = collection.begin(); it != collection.end(); ++it)
+            counted += *it == value;
+        BOOST_CHECK_EQUAL(counted, expectedCounts[value]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollections_WhenAskingForValueIndexMemory_ThenOnlyIndexedOneUsesAny)
+{
+    const LinearCollection<int> plain = { 1, 2, 3 };
+    const HashedCollection<int> indexed = { 1, 2, 3 };
+
+    BOOST_CHECK_EQUAL(plain.getValueIndexMemoryUsage(), 0);
+    BOOST_CHECK(indexed.getValueIndexMemoryUsage() > 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithHandles_WhenAppending_ThenHandlesResolveToItems,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection;
+    collection.enableHandles();
+
+    auto first = collection.append(1);
+    auto second = collection.prepend(2);
+    auto third = collection.insert(collection.end(), 3);
+
+    BOOST_CHECK(collection.isValid(first));
+    BOOST_CHECK_EQUAL(*collection.iteratorTo(first), T(1));
+    BOOST_CHECK_EQUAL(*collection.iteratorTo(second), T(2));
+    BOOST_CHECK_EQUAL(*collection.iteratorTo(third), T(3));
+    BOOST_CHECK(first != second);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithHandles_WhenErasingByHandle_ThenHandleGoesStale,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection;
+    collection.enableHandles();
+    collection.append(1);
+    auto erased = collection.append(2);
+    collection.append(3);
+
+    collection.erase(erased);
+
+    thenCollectionContainsValues(collection, { 1, 3 });
+    BOOST_CHECK(!collection.isValid(erased));
+    BOOST_CHECK_THROW(collection.erase(erased), std::invalid_argument);
+    BOOST_CHECK_THROW(collection.moveToFront(erased), std::invalid_argument);
+    thenCollectionContainsValues(collection, { 1, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenStaleHandle_WhenItsSlotIsReused_ThenItStaysStale)
+{
+    LinearCollection<int> collection;
+    collection.enableHandles();
+    auto stale = collection.append(1);
+    collection.popFirst();
+
+    auto fresh = collection.append(2);
+
+    BOOST_CHECK(!collection.isValid(stale));
+    BOOST_CHECK(collection.isValid(fresh));
+    BOOST_CHECK_THROW(collection.iteratorTo(stale), std::invalid_argument);
+    BOOST_CHECK_EQUAL(*collection.iteratorTo(fresh), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandlesTakenBeforeDisabling_WhenHandlesAreEnabledAgain_ThenOldHandlesStayStale)
+{
+    LinearCollection<int> collection;
+    collection.enableHandles();
+    auto reused = collection.append(1);
+    collection.popFirst();
+    auto first = collection.append(2);
+    auto second = collection.append(3);
+
+    collection.disableHandles();
+    collection.enableHandles();
+    collection.append(4);
+
+    BOOST_CHECK(!collection.isValid(reused));
+    BOOST_CHECK(!collection.isValid(first));
+    BOOST_CHECK(!collection.isValid(second));
+    BOOST_CHECK_THROW(collection.erase(first), std::invalid_argument);
+    BOOST_CHECK_THROW(collection.moveToFront(second), std::invalid_argument);
+    thenCollectionContainsValues(collection, { 2, 3, 4 });
+    BOOST_CHECK_EQUAL(*collection.iteratorTo(collection.handleOf(collection.begin())), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithoutHandles_WhenUsingReturnedHandle_ThenExceptionIsThrown)
+{
+    LinearCollection<int> collection;
+    auto handle = collection.append(1);
+
+    BOOST_CHECK(!collection.hasHandles());
+    BOOST_CHECK(!collection.isValid(handle));
+    BOOST_CHECK_THROW(collection.erase(handle), std::invalid_argument);
+    BOOST_CHECK_THROW(collection.handleOf(collection.begin()), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithHandles_WhenMovingToFront_ThenOrderChangesAndHandlesStay)
+{
+    LinearCollection<int> collection;
+    collection.enableHandles();
+    auto one = collection.append(1);
+    auto two = collection.append(2);
+    auto three = collection.append(3);
+
+    collection.moveToFront(three);
+    collection.moveToFront(two);
+    collection.moveToFront(two);
+
+    thenCollectionContainsValues(collection, { 2, 3, 1 });
+    BOOST_CHECK_EQUAL(*collection.iteratorTo(one), 1);
+    collection.erase(three);
+    thenCollectionContainsValues(collection, { 2, 1 });
+    BOOST_CHECK(collection.isValid(two));
+}
+
+BOOST_AUTO_TEST_CASE(GivenPositionalIndex_WhenMovingToFront_ThenPositionsFollow)
+{
+    LinearCollection<int> collection;
+    collection.enableHandles();
+    collection.enablePositionalIndex();
+    std::vector<LinearCollection<int>::Handle> handles;
+    for(int i = 0; i < 50; ++i)
+        handles.push_back(collection.append(i));
+
+    collection.moveToFront(handles[30]);
+    collection.moveToFront(handles[49]);
+
+    BOOST_CHECK_EQUAL(*(collection.begin() + 0), 49);
+    BOOST_CHECK_EQUAL(*(collection.begin() + 1), 30);
+    BOOST_CHECK_EQUAL(*(collection.begin() + 31), 29);
+    BOOST_CHECK_EQUAL(*(collection.begin() + 32), 31);
+    BOOST_CHECK_EQUAL(collection.indexOf(collection.iteratorTo(handles[10])), 12);
+}
+
+BOOST_AUTO_TEST_CASE(GivenExistingItems_WhenEnablingHandles_ThenHandlesCanBeTaken)
+{
+    LinearCollection<int> collection = { 1, 2, 3 };
+
+    collection.enableHandles();
+    auto handle = collection.handleOf(collection.begin() + 1);
+    collection.erase(handle);
+
+    thenCollectionContainsValues(collection, { 1, 3 });
+    BOOST_CHECK_THROW(collection.handleOf(collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithHandles_WhenSplicingItemsAway_ThenTheirHandlesGoStale)
+{
+    LinearCollection<int> collection;
+    LinearCollection<int> other;
+    collection.enableHandles();
+    other.enableHandles();
+    auto kept = collection.append(1);
+    auto moved = collection.append(2);
+
+    other.splice(other.end(), collection, collection.begin() + 1, collection.end());
+
+    BOOST_CHECK(collection.isValid(kept));
+    BOOST_CHECK(!collection.isValid(moved));
+    auto adopted = other.handleOf(other.begin());
+    other.moveToFront(adopted);
+    other.erase(adopted);
+    BOOST_CHECK(other.isEmpty());
+
+    other.splice(other.begin(), collection);
+    BOOST_CHECK(!collection.isValid(kept));
+    BOOST_CHECK_EQUAL(*other.iteratorTo(other.handleOf(other.begin())), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithHandles_WhenDefragmenting_ThenHandlesFollowTheNodes)
+{
+    LinearCollection<int> collection;
+    collection.enableHandles();
+    std::vector<LinearCollection<int>::Handle> handles;
+    for(int i = 0; i < 20; ++i)
+        handles.push_back(collection.append(i));
+
+    collection.defragment();
+    collection.moveToFront(handles[7]);
+
+    for(int i = 0; i < 20; ++i)
+        BOOST_CHECK_EQUAL(*collection.iteratorTo(handles[i]), i);
+    for(int i = 0; i < 20; ++i)
+        collection.erase(handles[i]);
+    BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithHandles_WhenMoved_ThenHandlesMoveAlong)
+{
+    LinearCollection<int> source;
+    source.enableHandles();
+    auto handle = source.append(1);
+    source.append(2);
+
+    LinearCollection<int> collection(std::move(source));
+    collection.erase(handle);
+
+    thenCollectionContainsValues(collection, { 2 });
+    BOOST_CHECK(collection.hasHandles());
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllocationStats_WhenAppendingAndErasing_ThenNodesAreCounted)
+{
+    LinearCollection<int> collection = { 1 };
+    collection.enableAllocationStats();
+    const std::size_t nodeBytes = collection.stats().liveBytes / 2; // one item and the sentinel
+
+    collection.append(2);
+    collection.append(3);
+    collection.popFirst();
+
+    aisdi::AllocationStats stats = collection.stats();
+    BOOST_CHECK_EQUAL(stats.allocations, 2);
+    BOOST_CHECK_EQUAL(stats.frees, 1);
+    BOOST_CHECK_EQUAL(stats.bytesAllocated, 2 * nodeBytes);
+    BOOST_CHECK_EQUAL(stats.liveBytes, 3 * nodeBytes);
+    BOOST_CHECK_EQUAL(stats.peakLiveBytes, 4 * nodeBytes);
+    BOOST_CHECK_EQUAL(stats.reallocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllocationStats_WhenSplicing_ThenLiveBytesMoveWithoutAllocations)
+{
+    LinearCollection<int> collection = { 1, 2 };
+    LinearCollection<int> other = { 3, 4, 5 };
+    collection.enableAllocationStats();
+    other.enableAllocationStats();
+    const std::size_t nodeBytes = collection.stats().liveBytes / 3;
+
+    collection.splice(collection.end(), other, other.begin(), other.begin() + 2);
+
+    BOOST_CHECK_EQUAL(collection.stats().liveBytes, 5 * nodeBytes);
+    BOOST_CHECK_EQUAL(other.stats().liveBytes, 2 * nodeBytes);
+    BOOST_CHECK_EQUAL(collection.stats().allocations, 0);
+    BOOST_CHECK_EQUAL(other.stats().frees, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllocationStats_WhenDefragmenting_ThenSlabIsOneReallocation)
+{
+    LinearCollection<int> collection = { 1, 2, 3, 4 };
+    collection.enableAllocationStats();
+    const std::size_t nodeBytes = collection.stats().liveBytes / 5;
+
+    collection.defragment();
+
+    aisdi::AllocationStats stats = collection.stats();
+    BOOST_CHECK_EQUAL(stats.allocations, 1);
+    BOOST_CHECK_EQUAL(stats.reallocations, 1);
+    BOOST_CHECK_EQUAL(stats.frees, 4);
+    BOOST_CHECK_EQUAL(stats.liveBytes, 5 * nodeBytes);
+}
+
+// popping copies OperationCountingObject: its move may throw, the list stays whole if the copy does
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAddingTemporaries_ThenNothingIsCopied,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 753, 1789 };
+
+    OperationCountingObject::resetCounters();
+    collection.append(T(2016));
+    collection.prepend(T(1410));
+    collection.insert(begin(collection) + 2, T(1000));
+
+    thenCollectionContainsValues(collection, { 1410, 753, 1000, 1789, 2016 });
+    thenCopiedObjectsCountWas<T>(0);
+    thenMovedObjectsCountWas<T>(3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyItems_WhenAddingAndPopping_ThenItemsAreMoved)
+{
+    LinearCollection<std::unique_ptr<int>> collection;
+    collection.append(std::unique_ptr<int>(new int(2)));
+    collection.prepend(std::unique_ptr<int>(new int(1)));
+    collection.insert(end(collection), std::unique_ptr<int>(new int(3)));
+
+    std::unique_ptr<int> first = collection.popFirst();
+    std::unique_ptr<int> last = collection.popLast();
+
+    BOOST_CHECK_EQUAL(*first, 1);
+    BOOST_CHECK_EQUAL(*last, 3);
+    BOOST_REQUIRE_EQUAL(collection.getSize(), 1);
+    BOOST_CHECK_EQUAL(**begin(collection), 2);
+}
+
+// a moved-from string is empty: the index has to forget an item before it is moved out
+BOOST_AUTO_TEST_CASE(GivenValueIndex_WhenPoppingMovedItems_ThenIndexForgetsThem)
+{
+    const std::string longText(40, 'x'); // beyond the small string buffer, so it is really moved
+    HashedCollection<std::string> collection = { "first" + longText, "middle", "last" + longText };
+
+    std::string first = collection.popFirst();
+    std::string last = collection.popLast();
+
+    BOOST_CHECK_EQUAL(first, "first" + longText);
+    BOOST_CHECK_EQUAL(last, "last" + longText);
+    BOOST_CHECK(!collection.contains(first));
+    BOOST_CHECK(!collection.contains(last));
+    BOOST_CHECK(!collection.contains(""));
+    BOOST_CHECK(collection.contains("middle"));
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
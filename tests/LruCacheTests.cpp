@@ -0,0 +1,206 @@
+#include <LruCache.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+template <typename K>
+using Cache = aisdi::LruCache<K, std::string>;
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t>;
+
+std::size_t bytesOf(int, const std::string& value)
+{
+    return value.size();
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(LruCacheTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCache_WhenCreated_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    Cache<T> cache(3);
+
+    BOOST_CHECK(cache.isEmpty());
+    BOOST_CHECK_EQUAL(cache.getCapacity(), 3);
+    BOOST_CHECK(cache.get(1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GivenZeroCapacity_WhenCreatingCache_ThenExceptionIsThrown)
+{
+    BOOST_CHECK_THROW(Cache<int>(0), std::invalid_argument);
+    BOOST_CHECK_THROW(Cache<int>(0, bytesOf), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCache_WhenPutting_ThenValuesAreFound,
+                              T,
+                              TestedTypes)
+{
+    Cache<T> cache(3);
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+
+    BOOST_REQUIRE(cache.get(1) != nullptr);
+    BOOST_CHECK_EQUAL(*cache.get(1), "one");
+    BOOST_CHECK_EQUAL(*cache.get(2), "two");
+    BOOST_CHECK_EQUAL(cache.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFullCache_WhenPutting_ThenLeastRecentlyUsedIsEvicted,
+                              T,
+                              TestedTypes)
+{
+    Cache<T> cache(3);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+
+    cache.get(1);
+    cache.put(4, "four");
+
+    BOOST_CHECK_EQUAL(cache.getSize(), 3);
+    BOOST_CHECK(!cache.contains(2));
+    BOOST_CHECK(cache.contains(1));
+    BOOST_CHECK(cache.contains(3));
+    BOOST_CHECK(cache.contains(4));
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullCache_WhenCheckingContains_ThenRecencyIsNotChanged)
+{
+    Cache<int> cache(2);
+    cache.put(1, "one");
+    cache.put(2, "two");
+
+    cache.contains(1);
+    cache.put(3, "three");
+
+    BOOST_CHECK(!cache.contains(1));
+    BOOST_CHECK(cache.contains(2));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCachedKey_WhenPuttingAgain_ThenValueIsReplacedAndTouched)
+{
+    Cache<int> cache(2);
+    cache.put(1, "one");
+    cache.put(2, "two");
+
+    cache.put(1, "uno");
+    cache.put(3, "three");
+
+    BOOST_CHECK_EQUAL(cache.getSize(), 2);
+    BOOST_CHECK_EQUAL(*cache.get(1), "uno");
+    BOOST_CHECK(!cache.contains(2));
+}
+
+BOOST_AUTO_TEST_CASE(GivenByteCapacity_WhenPutting_ThenEntriesAreEvictedUntilTheyFit)
+{
+    Cache<int> cache(10, bytesOf);
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    BOOST_CHECK_EQUAL(cache.getUsage(), 8);
+
+    cache.put(3, "cccccc");
+
+    BOOST_CHECK_EQUAL(cache.getUsage(), 10);
+    BOOST_CHECK(!cache.contains(1));
+    BOOST_CHECK(cache.contains(2));
+    BOOST_CHECK(cache.contains(3));
+}
+
+BOOST_AUTO_TEST_CASE(GivenByteCapacity_WhenReplacingWithLargerValue_ThenUsageFollows)
+{
+    Cache<int> cache(10, bytesOf);
+    cache.put(1, "aa");
+    cache.put(2, "bb");
+
+    cache.put(2, "bbbbbbbbb");
+
+    BOOST_CHECK_EQUAL(cache.getUsage(), 9);
+    BOOST_CHECK(!cache.contains(1));
+}
+
+BOOST_AUTO_TEST_CASE(GivenByteCapacity_WhenPuttingTooLargeEntry_ThenExceptionIsThrown)
+{
+    Cache<int> cache(4, bytesOf);
+    cache.put(1, "aa");
+
+    BOOST_CHECK_THROW(cache.put(2, "aaaaa"), std::length_error);
+    BOOST_CHECK_EQUAL(*cache.get(1), "aa");
+    BOOST_CHECK_EQUAL(cache.getUsage(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenErasing_ThenEntryIsGone)
+{
+    Cache<int> cache(3, bytesOf);
+    cache.put(1, "a");
+    cache.put(2, "b");
+
+    BOOST_CHECK(cache.erase(1));
+    BOOST_CHECK(!cache.erase(1));
+
+    BOOST_CHECK(!cache.contains(1));
+    BOOST_CHECK_EQUAL(cache.getSize(), 1);
+    BOOST_CHECK_EQUAL(cache.getUsage(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenGettingMany_ThenHitsAndMissesAreReported)
+{
+    Cache<int> cache(3);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    const int keys[] = { 1, 5, 3, 1, 7 };
+    std::string * values[5];
+
+    BOOST_CHECK_EQUAL(cache.getMany(keys, 5, values), 3);
+
+    BOOST_REQUIRE(values[0] && values[2] && values[3]);
+    BOOST_CHECK_EQUAL(*values[0], "one");
+    BOOST_CHECK(values[1] == nullptr);
+    BOOST_CHECK_EQUAL(*values[2], "three");
+    BOOST_CHECK(values[4] == nullptr);
+    cache.put(4, "four");
+    BOOST_CHECK(!cache.contains(2));
+}
+
+BOOST_AUTO_TEST_CASE(GivenLargeCache_WhenCyclingKeys_ThenOnlyTheLastOnesStay)
+{
+    Cache<int> cache(100);
+
+    for(int i = 0; i < 10000; ++i)
+        cache.put(i, std::to_string(i));
+
+    BOOST_CHECK_EQUAL(cache.getSize(), 100);
+    for(int i = 9900; i < 10000; ++i)
+        BOOST_CHECK(cache.contains(i));
+    BOOST_CHECK(!cache.contains(9899));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenCleared_ThenItIsEmptyAndReusable)
+{
+    Cache<int> cache(3);
+    cache.put(1, "one");
+
+    cache.clear();
+    cache.put(2, "two");
+
+    BOOST_CHECK(!cache.contains(1));
+    BOOST_CHECK_EQUAL(cache.getSize(), 1);
+    BOOST_CHECK_EQUAL(cache.getUsage(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
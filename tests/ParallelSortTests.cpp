@@ -0,0 +1,160 @@
+#include <ParallelSort.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(ParallelSortTests)
+
+template <typename T>
+void thenCollectionIsSorted(const aisdi::Vector<T>& collection)
+{
+    std::size_t unordered = 0;
+    for(auto it = begin(collection); it != end(collection) && it + 1 != end(collection); ++it)
+        unordered += *(it + 1) < *it;
+    BOOST_CHECK_EQUAL(unordered, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyVector_WhenSorting_ThenItStaysEmpty,
+                              T,
+                              TestedTypes)
+{
+    aisdi::ThreadPool pool(2);
+    aisdi::Vector<T> collection;
+
+    aisdi::parallelMergeSort(collection, pool);
+
+    BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSmallVector_WhenSorting_ThenItemsAreOrdered,
+                              T,
+                              TestedTypes)
+{
+    aisdi::ThreadPool pool(2);
+    aisdi::Vector<T> collection = { 5, 3, 9, 1, 3, 0 };
+
+    aisdi::parallelMergeSort(collection, pool);
+
+    T expected[] = { 0, 1, 3, 3, 5, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLargeVector_WhenSortingOnManyThreads_ThenItemsAreOrdered,
+                              T,
+                              TestedTypes)
+{
+    aisdi::ThreadPool pool(4);
+    aisdi::Vector<T> collection;
+    std::uint32_t state = 12345;
+    for(std::size_t i = 0; i < 100000; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        collection.append(static_cast<T>(state >> 8));
+    }
+
+    aisdi::parallelMergeSort(collection, pool);
+
+    BOOST_CHECK_EQUAL(collection.getSize(), 100000);
+    thenCollectionIsSorted(collection);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualKeys_WhenSortingWithComparator_ThenOriginalOrderIsKept)
+{
+    aisdi::ThreadPool pool(4);
+    aisdi::Vector<std::pair<int, std::size_t>> collection;
+    for(std::size_t i = 0; i < 50000; ++i)
+        collection.append(std::make_pair(static_cast<int>(i % 7), i));
+
+    aisdi::parallelMergeSort(collection, pool, [](const std::pair<int, std::size_t>& a, const std::pair<int, std::size_t>& b)
+    {
+        return a.first < b.first;
+    });
+
+    std::size_t unstable = 0;
+    for(auto it = begin(collection); it + 1 != end(collection); ++it)
+        unstable += (*it).first == (*(it + 1)).first && (*it).second > (*(it + 1)).second;
+    BOOST_CHECK_EQUAL(unstable, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLargeLinkedList_WhenSortingOnManyThreads_ThenItemsAreOrdered,
+                              T,
+                              TestedTypes)
+{
+    aisdi::ThreadPool pool(4);
+    aisdi::LinkedList<T> collection;
+    std::uint32_t state = 54321;
+    for(std::size_t i = 0; i < 100001; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        collection.append(static_cast<T>(state >> 8));
+    }
+
+    aisdi::parallelMergeSort(collection, pool);
+
+    BOOST_CHECK_EQUAL(collection.getSize(), 100001);
+    std::size_t unordered = 0, visited = 0;
+    for(auto it = begin(collection); it != end(collection); ++it, ++visited)
+        unordered += it + 1 != end(collection) && *(it + 1) < *it;
+    BOOST_CHECK_EQUAL(unordered, 0);
+    BOOST_CHECK_EQUAL(visited, 100001);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedListWithEqualKeys_WhenSortingOnManyThreads_ThenOriginalOrderIsKept)
+{
+    aisdi::ThreadPool pool(4);
+    aisdi::LinkedList<std::pair<int, std::size_t>> collection;
+    for(std::size_t i = 0; i < 50000; ++i)
+        collection.append(std::make_pair(static_cast<int>((i * 7) % 11), i));
+
+    aisdi::parallelMergeSort(collection, pool, [](const std::pair<int, std::size_t>& a, const std::pair<int, std::size_t>& b)
+    {
+        return a.first < b.first;
+    });
+
+    std::size_t unstable = 0;
+    for(auto it = begin(collection); it + 1 != end(collection); ++it)
+        unstable += (*it).first > (*(it + 1)).first
+            || ((*it).first == (*(it + 1)).first && (*it).second > (*(it + 1)).second);
+    BOOST_CHECK_EQUAL(unstable, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedListWithHandles_WhenSortingOnManyThreads_ThenHandlesStayValid)
+{
+    aisdi::ThreadPool pool(4);
+    aisdi::LinkedList<int> collection;
+    collection.enableHandles();
+    std::vector<aisdi::LinkedList<int>::Handle> handles;
+    for(int i = 0; i < 50000; ++i)
+        handles.push_back(collection.append((i * 7919) % 50000));
+
+    aisdi::parallelMergeSort(collection, pool);
+
+    std::size_t unordered = 0;
+    for(auto it = begin(collection); it + 1 != end(collection); ++it)
+        unordered += *(it + 1) < *it;
+    BOOST_CHECK_EQUAL(unordered, 0);
+    std::size_t stale = 0, moved = 0;
+    for(int i = 0; i < 50000; ++i)
+    {
+        stale += !collection.isValid(handles[i]);
+        moved += collection.isValid(handles[i]) && *collection.iteratorTo(handles[i]) != (i * 7919) % 50000;
+    }
+    BOOST_CHECK_EQUAL(stale, 0);
+    BOOST_CHECK_EQUAL(moved, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
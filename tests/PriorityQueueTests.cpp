@@ -0,0 +1,187 @@
+#include <PriorityQueue.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+using TestedQueues = boost::mpl::list<aisdi::PriorityQueue<std::int32_t, std::less<std::int32_t>, 2>,
+      aisdi::PriorityQueue<std::int32_t, std::less<std::int32_t>, 4>,
+      aisdi::PriorityQueue<std::int32_t, std::less<std::int32_t>, 8>,
+      aisdi::PriorityQueue<std::uint64_t, std::less<std::uint64_t>, 3>>;
+
+std::vector<std::int32_t> pseudoRandomValues(std::size_t count)
+{
+    std::vector<std::int32_t> values;
+    std::uint32_t state = 12345;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        values.push_back(static_cast<std::int32_t>((state >> 8) % 1000));
+    }
+    return values;
+}
+
+template <typename Queue>
+std::vector<std::int32_t> drain(Queue& queue)
+{
+    std::vector<std::int32_t> result;
+    while(!queue.isEmpty())
+        result.push_back(static_cast<std::int32_t>(queue.pop()));
+    return result;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PriorityQueueTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenPriorityQueue_WhenCreated_ThenItIsEmpty,
+                              Queue,
+                              TestedQueues)
+{
+    Queue queue;
+
+    BOOST_CHECK(queue.isEmpty());
+    BOOST_CHECK_EQUAL(queue.getSize(), 0);
+    BOOST_CHECK_THROW(queue.top(), std::logic_error);
+    BOOST_CHECK_THROW(queue.pop(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenPriorityQueue_WhenPushing_ThenTopIsTheLeastItem,
+                              Queue,
+                              TestedQueues)
+{
+    Queue queue;
+
+    queue.push(5);
+    queue.push(3);
+    queue.push(8);
+
+    BOOST_CHECK_EQUAL(queue.top(), 3);
+    BOOST_CHECK_EQUAL(queue.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenPriorityQueue_WhenPoppingAll_ThenItemsComeInOrder,
+                              Queue,
+                              TestedQueues)
+{
+    Queue queue;
+    std::vector<std::int32_t> values = pseudoRandomValues(500);
+    for(auto value : values)
+        queue.push(value);
+
+    std::vector<std::int32_t> popped = drain(queue);
+
+    std::sort(values.begin(), values.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), values.begin(), values.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRange_WhenHeapifying_ThenItemsComeInOrder,
+                              Queue,
+                              TestedQueues)
+{
+    Queue queue;
+    queue.push(500);
+    std::vector<std::int32_t> values = pseudoRandomValues(300);
+
+    queue.heapify(values.begin(), values.end());
+
+    BOOST_CHECK_EQUAL(queue.getSize(), 301);
+    values.push_back(500);
+    std::sort(values.begin(), values.end());
+    std::vector<std::int32_t> popped = drain(queue);
+    BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), values.begin(), values.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenHandles_WhenDecreasingKeys_ThenItemsMoveUp,
+                              Queue,
+                              TestedQueues)
+{
+    Queue queue;
+    std::vector<typename Queue::Handle> handles;
+    for(int i = 0; i < 100; ++i)
+        handles.push_back(queue.push(100 + i));
+
+    queue.decreaseKey(handles[70], 5);
+    queue.decreaseKey(handles[30], 7);
+    queue.decreaseKey(handles[70], 1);
+
+    BOOST_CHECK_EQUAL(queue.get(handles[30]), 7);
+    BOOST_CHECK_EQUAL(queue.pop(), 1);
+    BOOST_CHECK_EQUAL(queue.pop(), 7);
+    BOOST_CHECK_EQUAL(queue.pop(), 100);
+    BOOST_CHECK_EQUAL(queue.get(handles[99]), 199);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandle_WhenIncreasingKey_ThenExceptionIsThrown)
+{
+    aisdi::PriorityQueue<int> queue;
+    auto handle = queue.push(10);
+
+    BOOST_CHECK_THROW(queue.decreaseKey(handle, 11), std::invalid_argument);
+    BOOST_CHECK_NO_THROW(queue.decreaseKey(handle, 10));
+    BOOST_CHECK_EQUAL(queue.top(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPoppedItem_WhenUsingItsHandle_ThenItIsDetectedAsStale)
+{
+    aisdi::PriorityQueue<int> queue;
+    auto popped = queue.push(1);
+    queue.push(2);
+    queue.pop();
+
+    auto reused = queue.push(3);
+
+    BOOST_CHECK(!queue.isValid(popped));
+    BOOST_CHECK(queue.isValid(reused));
+    BOOST_CHECK_THROW(queue.get(popped), std::invalid_argument);
+    BOOST_CHECK_THROW(queue.decreaseKey(popped, 0), std::invalid_argument);
+    BOOST_CHECK_EQUAL(queue.top(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenGreaterComparator_WhenPopping_ThenGreatestItemsComeFirst)
+{
+    aisdi::PriorityQueue<int, std::greater<int>, 2> queue;
+    queue.push(1);
+    queue.push(9);
+    queue.push(4);
+
+    BOOST_CHECK_EQUAL(queue.pop(), 9);
+    BOOST_CHECK_EQUAL(queue.pop(), 4);
+    BOOST_CHECK_EQUAL(queue.pop(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMixedOperations_WhenDraining_ThenOrderIsKept)
+{
+    aisdi::PriorityQueue<int, std::less<int>, 4> queue;
+    std::vector<aisdi::PriorityQueue<int, std::less<int>, 4>::Handle> handles;
+    std::vector<std::int32_t> values = pseudoRandomValues(1000);
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        handles.push_back(queue.push(values[i] + 1000));
+        if(i % 3 == 0)
+            queue.pop();
+    }
+    for(std::size_t i = 0; i < handles.size(); i += 7)
+    {
+        if(queue.isValid(handles[i]))
+            queue.decreaseKey(handles[i], queue.get(handles[i]) - 1000);
+    }
+
+    std::vector<std::int32_t> popped = drain(queue);
+
+    BOOST_CHECK(std::is_sorted(popped.begin(), popped.end()));
+    BOOST_CHECK_EQUAL(popped.size(), 666);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+#include <SlotMap.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t,
+      std::string>;
+
+template <typename T>
+T valueOf(int value)
+{
+    return static_cast<T>(value);
+}
+
+template <>
+std::string valueOf<std::string>(int value)
+{
+    return std::to_string(value);
+}
+
+template <typename T>
+std::size_t countOf(const aisdi::SlotMap<T>& map, const T& value)
+{
+    std::size_t result = 0;
+    for(auto it = map.begin(); it != map.end(); ++it)
+        result += *it == value;
+    return result;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SlotMapTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSlotMap_WhenCreated_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    const aisdi::SlotMap<T> map;
+
+    BOOST_CHECK(map.isEmpty());
+    BOOST_CHECK_EQUAL(map.getSize(), 0);
+    BOOST_CHECK(map.begin() == map.end());
+    BOOST_CHECK(!map.isValid(typename aisdi::SlotMap<T>::Handle()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSlotMap_WhenInserting_ThenHandlesGiveTheValues,
+                              T,
+                              TestedTypes)
+{
+    aisdi::SlotMap<T> map;
+
+    auto first = map.insert(valueOf<T>(1));
+    auto second = map.insert(valueOf<T>(2));
+
+    BOOST_CHECK_EQUAL(map.getSize(), 2);
+    BOOST_CHECK(map.get(first) == valueOf<T>(1));
+    BOOST_CHECK(*map.find(second) == valueOf<T>(2));
+    BOOST_CHECK(first != second);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSlotMap_WhenErasing_ThenOtherHandlesStayValid,
+                              T,
+                              TestedTypes)
+{
+    aisdi::SlotMap<T> map;
+    std::vector<typename aisdi::SlotMap<T>::Handle> handles;
+    for(int i = 0; i < 10; ++i)
+        handles.push_back(map.insert(valueOf<T>(i)));
+
+    map.erase(handles[0]);
+    map.erase(handles[5]);
+
+    BOOST_CHECK_EQUAL(map.getSize(), 8);
+    for(int i = 0; i < 10; ++i)
+    {
+        if(i == 0 || i == 5)
+            continue;
+        BOOST_CHECK(map.get(handles[i]) == valueOf<T>(i));
+    }
+    BOOST_CHECK_EQUAL(countOf(map, valueOf<T>(5)), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenErasedHandle_WhenUsingIt_ThenItIsDetectedAsStale,
+                              T,
+                              TestedTypes)
+{
+    aisdi::SlotMap<T> map;
+    auto stale = map.insert(valueOf<T>(1));
+    map.erase(stale);
+
+    auto reused = map.insert(valueOf<T>(2));
+
+    BOOST_CHECK(!map.isValid(stale));
+    BOOST_CHECK(map.find(stale) == nullptr);
+    BOOST_CHECK_THROW(map.get(stale), std::invalid_argument);
+    BOOST_CHECK_THROW(map.erase(stale), std::invalid_argument);
+    BOOST_CHECK(map.get(reused) == valueOf<T>(2));
+    BOOST_CHECK_EQUAL(map.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSlotMap_WhenIterating_ThenHandlesCanBeTakenFromPositions)
+{
+    aisdi::SlotMap<int> map;
+    auto one = map.insert(1);
+    map.insert(2);
+    map.insert(3);
+    map.erase(one);
+
+    int sum = 0;
+    for(std::size_t i = 0; i < map.getSize(); ++i)
+        sum += map.get(map.handleAt(i));
+
+    BOOST_CHECK_EQUAL(sum, 5);
+    BOOST_CHECK_THROW(map.handleAt(2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSlotMap_WhenIteratingMutably_ThenValuesChange)
+{
+    aisdi::SlotMap<int> map;
+    auto handle = map.insert(1);
+    map.insert(2);
+
+    for(auto it = map.begin(); it != map.end(); ++it)
+        *it *= 10;
+
+    BOOST_CHECK_EQUAL(map.get(handle), 10);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSlotMap_WhenCleared_ThenAllHandlesGoStale)
+{
+    aisdi::SlotMap<int> map;
+    auto first = map.insert(1);
+    auto second = map.insert(2);
+
+    map.clear();
+
+    BOOST_CHECK(map.isEmpty());
+    BOOST_CHECK(!map.isValid(first));
+    BOOST_CHECK(!map.isValid(second));
+    auto handle = map.insert(3);
+    BOOST_CHECK_EQUAL(map.get(handle), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSlotMap_WhenChurning_ThenLiveHandlesAlwaysResolve)
+{
+    aisdi::SlotMap<int> map;
+    std::vector<aisdi::SlotMap<int>::Handle> live;
+    std::vector<int> liveValues;
+    std::vector<aisdi::SlotMap<int>::Handle> dead;
+    std::uint32_t state = 7;
+
+    for(int step = 0; step < 5000; ++step)
+    {
+        state = state * 1664525u + 1013904223u;
+        if(live.empty() || (state >> 16) % 3 != 0)
+        {
+            live.push_back(map.insert(step));
+            liveValues.push_back(step);
+        }
+        else
+        {
+            std::size_t victim = (state >> 8) % live.size();
+            map.erase(live[victim]);
+            dead.push_back(live[victim]);
+            live[victim] = live.back();
+            liveValues[victim] = liveValues.back();
+            live.pop_back();
+            liveValues.pop_back();
+        }
+    }
+
+    BOOST_CHECK_EQUAL(map.getSize(), live.size());
+    for(std::size_t i = 0; i < live.size(); ++i)
+        BOOST_CHECK_EQUAL(map.get(live[i]), liveValues[i]);
+    for(std::size_t i = 0; i < dead.size(); ++i)
+        BOOST_CHECK(!map.isValid(dead[i]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,73 @@
+#include <ThreadPool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+std::size_t fibonacci(aisdi::ThreadPool& pool, std::size_t n)
+{
+    if(n < 2)
+        return n;
+    std::size_t left = 0;
+    aisdi::ThreadPool::TaskGroup group;
+    pool.spawn(group, [&] { left = fibonacci(pool, n - 1); });
+    std::size_t right = fibonacci(pool, n - 2);
+    pool.wait(group);
+    return left + right;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTests)
+
+BOOST_AUTO_TEST_CASE(GivenPool_WhenCreatedWithZeroThreads_ThenOperationThrows)
+{
+    BOOST_CHECK_THROW(aisdi::ThreadPool pool(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPool_WhenSpawningTasks_ThenAllOfThemRunBeforeWaitReturns)
+{
+    aisdi::ThreadPool pool(4);
+    std::atomic<std::size_t> counter(0);
+    aisdi::ThreadPool::TaskGroup group;
+
+    for(std::size_t i = 0; i < 1000; ++i)
+        pool.spawn(group, [&counter] { counter.fetch_add(1); });
+    pool.wait(group);
+
+    BOOST_CHECK_EQUAL(counter.load(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPool_WhenTasksSpawnRecursively_ThenResultIsComputed)
+{
+    aisdi::ThreadPool pool(4);
+
+    BOOST_CHECK_EQUAL(fibonacci(pool, 20), 6765);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSingleThreadPool_WhenTasksSpawnRecursively_ThenWaitDoesNotDeadlock)
+{
+    aisdi::ThreadPool pool(1);
+
+    BOOST_CHECK_EQUAL(fibonacci(pool, 15), 610);
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingTask_WhenWaiting_ThenExceptionIsRethrown)
+{
+    aisdi::ThreadPool pool(2);
+    aisdi::ThreadPool::TaskGroup group;
+
+    pool.spawn(group, [] { throw std::runtime_error("task failed"); });
+    pool.spawn(group, [] {});
+
+    BOOST_CHECK_THROW(pool.wait(group), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
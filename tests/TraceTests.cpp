@@ -0,0 +1,168 @@
+#include <Trace.h>
+#include <TraceRecorder.h>
+
+#include <Vector.h>
+#include <LinkedList.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+using aisdi::Trace;
+using aisdi::TraceEvent;
+using aisdi::TraceFormat;
+using aisdi::TraceOperation;
+
+using TestedContainers = boost::mpl::list<aisdi::Vector<int>,
+      aisdi::LinkedList<int>>;
+
+void thenEventIs(const TraceEvent& event, TraceOperation operation, std::uint64_t argument, std::uint64_t repeat)
+{
+    BOOST_CHECK(event.operation == operation);
+    BOOST_CHECK_EQUAL(event.argument, argument);
+    BOOST_CHECK_EQUAL(event.repeat, repeat);
+}
+
+Trace makeTrace()
+{
+    Trace trace;
+    trace.append(TraceEvent { TraceOperation::append, 0, 1000 });
+    trace.append(TraceEvent { TraceOperation::prepend, 0, 1 });
+    trace.append(TraceEvent { TraceOperation::insert, 300, 2 });
+    trace.append(TraceEvent { TraceOperation::erase, 1002, 1 });
+    trace.append(TraceEvent { TraceOperation::iterate, 16, 1 });
+    trace.append(TraceEvent { TraceOperation::popFirst, 0, 500 });
+    trace.append(TraceEvent { TraceOperation::popLast, 0, 1 });
+    return trace;
+}
+
+Trace writeAndRead(const Trace& trace, TraceFormat format)
+{
+    std::stringstream stream;
+    aisdi::writeTrace(stream, trace, format);
+    return aisdi::readTrace(stream);
+}
+
+void thenTracesAreEqual(const Trace& read, const Trace& written)
+{
+    BOOST_REQUIRE_EQUAL(read.getSize(), written.getSize());
+    for(std::size_t i = 0; i < written.getSize(); ++i)
+        thenEventIs(read[i], written[i].operation, written[i].argument, written[i].repeat);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(TraceTests)
+
+BOOST_AUTO_TEST_CASE(GivenTrace_WhenWrittenAsBinary_ThenItIsReadBack)
+{
+    const Trace trace = makeTrace();
+
+    thenTracesAreEqual(writeAndRead(trace, TraceFormat::binary), trace);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTrace_WhenWrittenAsText_ThenItIsReadBack)
+{
+    const Trace trace = makeTrace();
+
+    thenTracesAreEqual(writeAndRead(trace, TraceFormat::text), trace);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRepeatedEvents_WhenWrittenAsBinary_ThenTheyTakeAFewBytes)
+{
+    std::stringstream stream;
+    {
+        aisdi::TraceWriter writer(stream, TraceFormat::binary);
+        for(int i = 0; i < 100000; ++i)
+            writer.write(TraceOperation::append);
+        writer.write(TraceOperation::erase, 5);
+    }
+
+    BOOST_CHECK_EQUAL(stream.str().size(), sizeof(aisdi::traceMagic) + 4 + 2);
+    const Trace trace = aisdi::readTrace(stream);
+    BOOST_REQUIRE_EQUAL(trace.getSize(), 2);
+    thenEventIs(trace[0], TraceOperation::append, 0, 100000);
+    thenEventIs(trace[1], TraceOperation::erase, 5, 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandWrittenText_WhenReading_ThenCommentsAreSkipped)
+{
+    std::istringstream text("# a queue\n\nappend *3\n  insert 1\npopFirst\n");
+
+    const Trace trace = aisdi::readTrace(text);
+
+    BOOST_REQUIRE_EQUAL(trace.getSize(), 3);
+    thenEventIs(trace[0], TraceOperation::append, 0, 3);
+    thenEventIs(trace[1], TraceOperation::insert, 1, 1);
+    thenEventIs(trace[2], TraceOperation::popFirst, 0, 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMalformedText_WhenReading_ThenExceptionIsThrown)
+{
+    std::istringstream unknown("append\nshuffle\n");
+    std::istringstream missingPosition("insert\n");
+    std::istringstream badRepeat("append x3\n");
+    std::istringstream badNumber("erase -1\n");
+
+    BOOST_CHECK_THROW(aisdi::readTrace(unknown), std::runtime_error);
+    BOOST_CHECK_THROW(aisdi::readTrace(missingPosition), std::runtime_error);
+    BOOST_CHECK_THROW(aisdi::readTrace(badRepeat), std::runtime_error);
+    BOOST_CHECK_THROW(aisdi::readTrace(badNumber), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTruncatedBinary_WhenReading_ThenExceptionIsThrown)
+{
+    std::string binary(aisdi::traceMagic, sizeof(aisdi::traceMagic));
+    binary += static_cast<char>(TraceOperation::insert);
+    binary += static_cast<char>(0x80); // a varint continued past the end
+    std::istringstream stream(binary);
+
+    BOOST_CHECK_THROW(aisdi::readTrace(stream), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRecorder_WhenOperatingThroughIt_ThenContainerChangesAndPositionsAreRecorded,
+                              Container,
+                              TestedContainers)
+{
+    Container container;
+    std::stringstream stream;
+    {
+        aisdi::TraceWriter writer(stream, TraceFormat::text);
+        aisdi::TraceRecorder<Container> recorder(container, writer);
+        recorder.append(1);
+        recorder.append(2);
+        recorder.append(3);
+        recorder.prepend(0);
+        recorder.insert(recorder.cbegin() + 2, 10);
+        recorder.erase(recorder.cbegin() + 1);
+        int sum = 0;
+        recorder.iterate(100, [&sum](int item) { sum += item; });
+        BOOST_CHECK_EQUAL(sum, 15);
+        BOOST_CHECK_EQUAL(recorder.popFirst(), 0);
+        BOOST_CHECK_EQUAL(recorder.popLast(), 3);
+    }
+
+    BOOST_CHECK_EQUAL(container.getSize(), 2);
+    BOOST_CHECK_EQUAL(*container.cbegin(), 10);
+    const Trace trace = aisdi::readTrace(stream);
+    BOOST_REQUIRE_EQUAL(trace.getSize(), 7);
+    thenEventIs(trace[0], TraceOperation::append, 0, 3);
+    thenEventIs(trace[1], TraceOperation::prepend, 0, 1);
+    thenEventIs(trace[2], TraceOperation::insert, 2, 1);
+    thenEventIs(trace[3], TraceOperation::erase, 1, 1);
+    thenEventIs(trace[4], TraceOperation::iterate, 4, 1);
+    thenEventIs(trace[5], TraceOperation::popFirst, 0, 1);
+    thenEventIs(trace[6], TraceOperation::popLast, 0, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
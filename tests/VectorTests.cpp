@@ -4,6 +4,7 @@
 #include <complex>
 #include <cstdint>
 #include <cstddef>
+#include <memory>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/test_tools.hpp>
@@ -933,6 +934,109 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
     BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenIndexing_ThenItemsCanBeReadAndChanged,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 10, 20, 30 };
+
+    collection[1] = 25;
+
+    const LinearCollection<T>& constCollection = collection;
+    BOOST_CHECK_EQUAL(constCollection[0], 10);
+    BOOST_CHECK_EQUAL(constCollection[1], 25);
+    thenCollectionContainsValues(collection, { 10, 25, 30 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAskingIndexOfIterator_ThenItsPositionIsReturned,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection = { 10, 20, 30 };
+
+    BOOST_CHECK_EQUAL(collection.indexOf(collection.cbegin()), 0);
+    BOOST_CHECK_EQUAL(collection.indexOf(collection.cbegin() + 2), 2);
+    BOOST_CHECK_EQUAL(collection.indexOf(collection.cend()), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllocationStats_WhenCollectionGrows_ThenReallocationsAreCounted)
+{
+    LinearCollection<int> collection;
+    collection.enableAllocationStats();
+    const std::size_t initialCapacity = collection.getCapacity();
+    const std::size_t initialBytes = initialCapacity * sizeof(int);
+    BOOST_CHECK_EQUAL(collection.stats().liveBytes, initialBytes);
+
+    for(std::size_t i = 0; i <= initialCapacity; ++i)
+        collection.append(1);
+
+    aisdi::AllocationStats stats = collection.stats();
+    BOOST_CHECK_EQUAL(stats.allocations, 1);
+    BOOST_CHECK_EQUAL(stats.frees, 1);
+    BOOST_CHECK_EQUAL(stats.reallocations, 1);
+    BOOST_CHECK_EQUAL(stats.liveBytes, collection.getCapacity() * sizeof(int));
+    BOOST_CHECK_EQUAL(stats.bytesAllocated, collection.getCapacity() * sizeof(int));
+    BOOST_CHECK_EQUAL(stats.peakLiveBytes, stats.liveBytes + initialBytes);
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllocationStats_WhenMovingOrCopying_ThenOnlyMovesTakeThemAlong)
+{
+    LinearCollection<int> source = { 1, 2, 3 };
+    source.enableAllocationStats();
+
+    LinearCollection<int> copy(source);
+    LinearCollection<int> collection(std::move(source));
+
+    BOOST_CHECK(!copy.hasAllocationStats());
+    BOOST_CHECK_EQUAL(copy.stats().allocations, 0);
+    BOOST_CHECK(collection.hasAllocationStats());
+    BOOST_CHECK_EQUAL(collection.stats().liveBytes, collection.getCapacity() * sizeof(int));
+    collection.disableAllocationStats();
+    BOOST_CHECK_EQUAL(collection.stats().liveBytes, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAddingAndPoppingTemporaries_ThenNothingIsCopied,
+                              T,
+                              TestedTypes)
+{
+    LinearCollection<T> collection;
+    collection.append(T(753));
+    collection.append(T(1789));
+
+    OperationCountingObject::resetCounters();
+    collection.prepend(T(1410));
+    collection.insert(begin(collection) + 2, T(1000));
+    T first = collection.popFirst();
+    T last = collection.popLast();
+
+    BOOST_CHECK_EQUAL(first, T(1410));
+    BOOST_CHECK_EQUAL(last, T(1789));
+    thenCollectionContainsValues(collection, { 753, 1000 });
+    thenCopiedObjectsCountWas<T>(0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyItems_WhenGrowingShiftingAndErasing_ThenItemsAreMoved)
+{
+    LinearCollection<std::unique_ptr<int>> collection;
+    const std::size_t initialCapacity = collection.getCapacity();
+    for(std::size_t i = 0; i <= initialCapacity; ++i)
+        collection.append(std::unique_ptr<int>(new int(static_cast<int>(i))));
+    collection.prepend(std::unique_ptr<int>(new int(-1)));
+    collection.insert(begin(collection) + 1, std::unique_ptr<int>(new int(-2)));
+    collection.erase(begin(collection) + 2);
+    collection.erase(begin(collection) + 2, begin(collection) + 4);
+
+    std::unique_ptr<int> first = collection.popFirst();
+    std::unique_ptr<int> last = collection.popLast();
+
+    BOOST_CHECK_EQUAL(*first, -1);
+    BOOST_CHECK_EQUAL(*last, static_cast<int>(initialCapacity));
+    BOOST_REQUIRE_EQUAL(collection.getSize(), initialCapacity - 2);
+    BOOST_CHECK_EQUAL(*collection[0], -2);
+    for(std::size_t i = 1; i < collection.getSize(); ++i)
+        BOOST_CHECK_EQUAL(*collection[i], static_cast<int>(i + 2));
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
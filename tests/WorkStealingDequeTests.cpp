@@ -0,0 +1,156 @@
+#include <WorkStealingDeque.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+      std::uint64_t,
+      std::int16_t>;
+
+BOOST_AUTO_TEST_SUITE(WorkStealingDequeTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenDeque_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+    aisdi::WorkStealingDeque<T> deque;
+    T item {};
+
+    BOOST_CHECK(deque.isEmpty());
+    BOOST_CHECK_EQUAL(deque.getSize(), 0);
+    BOOST_CHECK(!deque.pop(item));
+    BOOST_CHECK(!deque.steal(item));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyDeque_WhenPopping_ThenItemsAreReturnedInLifoOrder,
+                              T,
+                              TestedTypes)
+{
+    aisdi::WorkStealingDeque<T> deque;
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+    T item {};
+
+    BOOST_CHECK(deque.pop(item));
+    BOOST_CHECK_EQUAL(item, 3);
+    BOOST_CHECK(deque.pop(item));
+    BOOST_CHECK_EQUAL(item, 2);
+    BOOST_CHECK_EQUAL(deque.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyDeque_WhenStealing_ThenItemsAreReturnedInFifoOrder,
+                              T,
+                              TestedTypes)
+{
+    aisdi::WorkStealingDeque<T> deque;
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+    T item {};
+
+    BOOST_CHECK(deque.steal(item));
+    BOOST_CHECK_EQUAL(item, 1);
+    BOOST_CHECK(deque.steal(item));
+    BOOST_CHECK_EQUAL(item, 2);
+    BOOST_CHECK(deque.pop(item));
+    BOOST_CHECK_EQUAL(item, 3);
+    BOOST_CHECK(deque.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFullDeque_WhenPushing_ThenCapacityGrowsAndItemsAreKept,
+                              T,
+                              TestedTypes)
+{
+    aisdi::WorkStealingDeque<T> deque;
+    const std::size_t initialCapacity = deque.getCapacity();
+    T item {};
+
+    for(std::size_t i = 0; i < initialCapacity * 4 + 1; ++i)
+        deque.push(static_cast<T>(i));
+
+    BOOST_CHECK_EQUAL(deque.getCapacity(), initialCapacity * 8);
+    BOOST_CHECK_EQUAL(deque.getSize(), initialCapacity * 4 + 1);
+    BOOST_CHECK(deque.steal(item));
+    BOOST_CHECK_EQUAL(item, 0);
+    BOOST_CHECK(deque.pop(item));
+    BOOST_CHECK_EQUAL(item, initialCapacity * 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenWrappedAroundDeque_WhenGrowing_ThenItemsKeepTheirOrder,
+                              T,
+                              TestedTypes)
+{
+    aisdi::WorkStealingDeque<T> deque;
+    const std::size_t initialCapacity = deque.getCapacity();
+    T item {};
+    for(std::size_t i = 0; i < initialCapacity; ++i)
+        deque.push(0);
+    for(std::size_t i = 0; i < initialCapacity; ++i)
+        deque.steal(item);
+
+    for(std::size_t i = 0; i < initialCapacity + 3; ++i)
+        deque.push(static_cast<T>(i));
+
+    for(std::size_t i = 0; i < initialCapacity + 3; ++i)
+    {
+        BOOST_CHECK(deque.steal(item));
+        BOOST_CHECK_EQUAL(item, i);
+    }
+    BOOST_CHECK(deque.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenOwnerAndThieves_WhenRunningConcurrently_ThenEveryItemIsTakenExactlyOnce)
+{
+    const std::size_t itemCount = 200000;
+    const std::size_t thiefCount = 3;
+    aisdi::WorkStealingDeque<std::size_t> deque;
+    std::vector<std::atomic<int>> taken(itemCount);
+    for(auto& counter : taken)
+        counter.store(0);
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> thieves;
+    for(std::size_t t = 0; t < thiefCount; ++t)
+    {
+        thieves.emplace_back([&]
+        {
+            std::size_t item;
+            while(!done.load())
+            {
+                if(deque.steal(item))
+                    taken[item].fetch_add(1);
+            }
+        });
+    }
+
+    std::size_t item;
+    for(std::size_t i = 0; i < itemCount; ++i)
+    {
+        deque.push(i);
+        if(i % 3 == 0 && deque.pop(item))
+            taken[item].fetch_add(1);
+    }
+    while(deque.pop(item))
+        taken[item].fetch_add(1);
+    while(!deque.isEmpty())
+        std::this_thread::yield();
+    done.store(true);
+    for(auto& thief : thieves)
+        thief.join();
+
+    std::size_t wrong = 0;
+    for(auto& counter : taken)
+        wrong += counter.load() != 1;
+    BOOST_CHECK_EQUAL(wrong, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()